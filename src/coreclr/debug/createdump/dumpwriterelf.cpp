@@ -168,7 +168,10 @@ DumpWriter::WriteDump()
 
     TRACE("Writing %" PRIu64 " memory regions to core file\n", phnum - 1);
 
-    // Read from target process and write memory regions to core
+    // Read from target process and write memory regions to core. Use a buffer much larger
+    // than m_tempBuffer so heap dumps of big processes don't take millions of read/write calls.
+    const size_t copyBufferSize = 1024 * 1024;
+    ArrayHolder<BYTE> copyBuffer = new BYTE[copyBufferSize];
     uint64_t total = 0;
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
     {
@@ -186,10 +189,10 @@ DumpWriter::WriteDump()
         {
             while (size > 0)
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
+                size_t bytesToRead = std::min(size, copyBufferSize);
                 size_t read = 0;
 
-                if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
+                if (!m_crashInfo.ReadProcessMemory(address, copyBuffer, bytesToRead, &read)) {
                     printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
                     return false;
                 }
@@ -200,7 +203,7 @@ DumpWriter::WriteDump()
                     return false;
                 }
 
-                if (!WriteData(m_tempBuffer, read)) {
+                if (!WriteData(copyBuffer, read)) {
                     return false;
                 }
 
@@ -307,6 +307,16 @@ public:
     //  true if it has succeeded, false if it has failed
     static bool VirtualReset(void *address, size_t size, bool unlock);
 
+    // Advise the OS whether to back the committed virtual memory range with huge pages when it can do
+    // so transparently, without reserving them up front.
+    // Parameters:
+    //  address - starting virtual address, must be page aligned
+    //  size    - size of the virtual memory range
+    //  enable  - true to ask for huge pages, false to ask for normal pages again
+    // Return:
+    //  true if the advice was accepted, false if it is not supported or has failed
+    static bool VirtualAdviseHugePages(void *address, size_t size, bool enable);
+
     //
     // Write watching
     //
@@ -42,10 +42,16 @@
 #endif // defined(FEATURE_SVR_GC)
 #endif // __INTELLISENSE__
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64) || (defined(TARGET_ARM64) && !defined(FEATURE_NATIVEAOT))
 #include "vxsort/do_vxsort.h"
 #endif
 
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#endif
+
 #ifdef SERVER_GC
 namespace SVR {
 #else // SERVER_GC
@@ -55,12 +61,21 @@ namespace WKS {
 #include "gcimpl.h"
 #include "gcpriv.h"
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64) || (defined(TARGET_ARM64) && !defined(FEATURE_NATIVEAOT))
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
 #endif
 
+#ifdef USE_VXSORT
+// the instruction set the vectorized mark list sort needs at a minimum
+#ifdef TARGET_ARM64
+#define VXSORT_BASE_INSTRUCTION_SET InstructionSet::NEON
+#else
+#define VXSORT_BASE_INSTRUCTION_SET InstructionSet::AVX2
+#endif
+#endif //USE_VXSORT
+
 #ifdef DACCESS_COMPILE
 #error this source file should not be compiled with DACCESS_COMPILE!
 #endif //DACCESS_COMPILE
@@ -95,6 +110,11 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 #define MAX_PTR ((uint8_t*)(~(ptrdiff_t)0))
 #define commit_min_th (16*OS_PAGE_SIZE)
 
+#ifdef USE_REGIONS
+// the transparent huge page size gen0/gen1 regions are committed in when gen0_huge_pages_p is set
+#define HUGE_PAGE_SIZE ((size_t)2*1024*1024)
+#endif //USE_REGIONS
+
 #define MIN_SOH_CROSS_GEN_REFS (400)
 #define MIN_LOH_CROSS_GEN_REFS (800)
 
@@ -2413,6 +2433,17 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
+uint64_t    gc_heap::pause_target = 0;
+float       gc_heap::pause_target_gen0_budget_factor = 1.0f;
+size_t      gc_heap::pause_target_miss_count = 0;
+uint64_t    gc_heap::total_alloc_contexts_unused_bytes = 0;
+#ifdef MH_SC_MARK
+size_t      gc_heap::mark_steal_threshold = 0;
+bool        gc_heap::mark_steal_ephemeral_p = false;
+#endif //MH_SC_MARK
+#ifdef USE_REGIONS
+bool        gc_heap::gen0_huge_pages_p = false;
+#endif //USE_REGIONS
 bool        gc_heap::spin_count_unit_config_p = false;
 
 uint64_t    gc_heap::suspended_start_time = 0;
@@ -2895,9 +2926,12 @@ size_t gc_heap::compact_or_sweep_gcs[2];
 
 #ifdef FEATURE_LOH_COMPACTION
 BOOL                   gc_heap::loh_compaction_always_p = FALSE;
+size_t                 gc_heap::loh_compaction_budget = 0;
 gc_loh_compaction_mode gc_heap::loh_compaction_mode = loh_compaction_default;
 #endif //FEATURE_LOH_COMPACTION
 
+bool                   gc_heap::poh_size_classes_p = false;
+
 GCEvent gc_heap::full_gc_approach_event;
 
 GCEvent gc_heap::full_gc_end_event;
@@ -2998,6 +3032,7 @@ unsigned int gc_heap::num_low_msl_acquire = 0;
 #endif //SYNCHRONIZATION_STATS
 
 size_t   gc_heap::alloc_contexts_used = 0;
+size_t   gc_heap::alloc_contexts_unused_bytes = 0;
 size_t   gc_heap::soh_allocation_no_gc = 0;
 size_t   gc_heap::loh_allocation_no_gc = 0;
 bool     gc_heap::no_gc_oom_p = false;
@@ -3233,9 +3268,27 @@ void gc_heap::fire_pevents()
     settings.record (current_gc_data_global);
     current_gc_data_global->print();
 
+    size_t unused_bytes = 0;
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < gc_heap::n_heaps; i++)
+    {
+        unused_bytes += gc_heap::g_heaps[i]->alloc_contexts_unused_bytes;
+    }
+#else
+    unused_bytes = alloc_contexts_unused_bytes;
+#endif //MULTIPLE_HEAPS
+    total_alloc_contexts_unused_bytes += unused_bytes;
+    dprintf (3, ("GC#%zd fixing alloc contexts left %zd bytes unused, %I64d total",
+        (size_t)settings.gc_index, unused_bytes, total_alloc_contexts_unused_bytes));
+
 #ifdef FEATURE_EVENT_TRACE
     if (!informational_event_enabled_p) return;
 
+    GCEventFireAllocContextsUnused_V1 (
+        (uint64_t)settings.gc_index,
+        (uint64_t)unused_bytes,
+        (uint64_t)total_alloc_contexts_unused_bytes);
+
     uint32_t count_time_info = (settings.concurrent ? max_bgc_time_type :
                                 (settings.compaction ? max_compact_time_type : max_sweep_time_type));
 
@@ -3334,6 +3387,59 @@ void gc_heap::fire_committed_usage_event()
         (uint64_t)total_committed_in_global_free,
         (uint64_t)total_bookkeeping_committed
     );
+
+    fire_bookkeeping_usage_event (total_bookkeeping_committed);
+#endif //FEATURE_EVENT_TRACE
+}
+
+// This breaks down what the bookkeeping in the CommittedUsage event is for so the overhead of the
+// GC's own data structures can be told apart from the heap. The sizes are how much of each element
+// is committed. With regions that's the part covering the range in use; with segments the tables are
+// committed for the whole range up front and the mark array is committed per segment.
+void gc_heap::fire_bookkeeping_usage_event (size_t total_bookkeeping_committed)
+{
+#ifdef FEATURE_EVENT_TRACE
+    size_t sizes[total_bookkeeping_elements];
+#ifdef USE_REGIONS
+    memcpy (sizes, bookkeeping_sizes, sizeof (sizes));
+#else
+    for (int i = card_table_element; i < total_bookkeeping_elements; i++)
+    {
+        sizes[i] = card_table_element_layout[i + 1] - card_table_element_layout[i];
+    }
+#ifdef BACKGROUND_GC
+    // only reserved for the whole range, see get_committed_mark_array_size
+    sizes[mark_array_element] = get_committed_mark_array_size();
+#endif //BACKGROUND_GC
+#endif //USE_REGIONS
+
+    uint64_t card_bundle_size = 0;
+    uint64_t software_write_watch_size = 0;
+    uint64_t region_to_generation_size = 0;
+    uint64_t mark_array_size = 0;
+#ifdef CARD_BUNDLE
+    card_bundle_size = sizes[card_bundle_table_element];
+#endif //CARD_BUNDLE
+#ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    software_write_watch_size = sizes[software_write_watch_table_element];
+#endif //FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+#ifdef USE_REGIONS
+    region_to_generation_size = sizes[region_to_generation_table_element];
+#endif //USE_REGIONS
+#ifdef BACKGROUND_GC
+    mark_array_size = sizes[mark_array_element];
+#endif //BACKGROUND_GC
+
+    GCEventFireBookkeepingUsage_V1 (
+        (uint64_t)total_bookkeeping_committed,
+        (uint64_t)sizes[card_table_element],
+        (uint64_t)sizes[brick_table_element],
+        card_bundle_size,
+        software_write_watch_size,
+        region_to_generation_size,
+        (uint64_t)sizes[seg_mapping_table_element],
+        mark_array_size,
+        (uint32_t)sizeof (seg_mapping));
 #endif //FEATURE_EVENT_TRACE
 }
 
@@ -7944,6 +8050,7 @@ void gc_heap::fix_allocation_context (alloc_context* acontext, BOOL for_gc_p,
 
     if (acontext->alloc_ptr == 0)
     {
+        // Keep the refill count; the context is adapted the next time it is fixed for a GC while holding a quantum.
         return;
     }
     int align_const = get_alignment_constant (TRUE);
@@ -7971,7 +8078,10 @@ void gc_heap::fix_allocation_context (alloc_context* acontext, BOOL for_gc_p,
         {
             generation_free_obj_space (generation_of (0)) += size;
             if (record_ac_p)
+            {
+                alloc_contexts_unused_bytes += size;
                 alloc_contexts_used ++;
+            }
         }
     }
     else if (for_gc_p)
@@ -7992,9 +8102,66 @@ void gc_heap::fix_allocation_context (alloc_context* acontext, BOOL for_gc_p,
 
         acontext->alloc_ptr = 0;
         acontext->alloc_limit = acontext->alloc_ptr;
+
+        // record_ac_p is only false when we fix the context while allocating, not for a GC
+        if (record_ac_p)
+        {
+            adapt_allocation_quantum (acontext);
+        }
     }
 }
 
+// Hot threads that keep coming back for a new quantum get larger ones so they take the more space lock
+// less often. Threads that only got a single quantum since their context was last adapted get smaller
+// ones since most of it is likely wasted when we fix their contexts for the next GC. A context is only
+// adapted while it holds a quantum, so it always got at least one.
+void gc_heap::adapt_allocation_quantum (alloc_context* acontext)
+{
+    const uint16_t hot_refill_count = 16;
+    const uint16_t cold_refill_count = 1;
+    const int max_quantum_shift = 3;
+    const int min_quantum_shift = -3;
+
+    uint16_t refill_count = acontext->get_quantum_refill_count();
+    int shift = acontext->get_quantum_shift();
+    int new_shift = shift;
+
+    if (refill_count >= hot_refill_count)
+    {
+        new_shift = min ((shift + 1), max_quantum_shift);
+    }
+    else if (refill_count <= cold_refill_count)
+    {
+        new_shift = max ((shift - 1), min_quantum_shift);
+    }
+
+    if (new_shift != shift)
+    {
+        dprintf (3, ("ac %p got %d quanta since last GC, quantum shift %d->%d",
+            acontext, refill_count, shift, new_shift));
+        acontext->set_quantum_shift (new_shift);
+    }
+
+    acontext->init_quantum_refill_count();
+}
+
+size_t gc_heap::get_allocation_quantum (alloc_context* acontext)
+{
+    int shift = acontext->get_quantum_shift();
+    size_t quantum = allocation_quantum;
+
+    if (shift > 0)
+    {
+        quantum <<= shift;
+    }
+    else if (shift < 0)
+    {
+        quantum = max ((quantum >> (-shift)), (size_t)1024);
+    }
+
+    return Align (quantum, get_alignment_constant (TRUE));
+}
+
 //used by the heap verification for concurrent gc.
 //it nulls out the words set by fix_allocation_context for heap_verification
 void repair_allocation (gc_alloc_context* acontext, void*)
@@ -10496,6 +10663,10 @@ private:
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+#ifdef TARGET_ARM64
+    // above this threshold, using AdvSimd for sorting will likely pay off
+    const ptrdiff_t NEON_THRESHOLD_SIZE = 8 * 1024;
+#else //TARGET_ARM64
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const ptrdiff_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -10503,10 +10674,18 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     // above this threshold, using AVX512F for sorting will likely pay off
     // despite possible downclocking on current devices
     const ptrdiff_t AVX512F_THRESHOLD_SIZE = 128 * 1024;
+#endif //TARGET_ARM64
 
     if (item_count <= 1)
         return;
 
+#ifdef TARGET_ARM64
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+#else //TARGET_ARM64
     if (IsSupportedInstructionSet (InstructionSet::AVX2) && (item_count > AVX2_THRESHOLD_SIZE))
     {
         dprintf(3, ("Sorting mark lists"));
@@ -10521,6 +10700,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
             do_vxsort_avx2 (item_array, &item_array[item_count - 1], range_low, range_high);
         }
     }
+#endif //TARGET_ARM64
     else
     {
         dprintf (3, ("Sorting mark lists"));
@@ -11163,10 +11343,10 @@ void gc_heap::grow_mark_list ()
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (VXSORT_BASE_INSTRUCTION_SET) ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (VXSORT_BASE_INSTRUCTION_SET) ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -12159,6 +12339,20 @@ bool gc_heap::is_region_demoted (uint8_t* obj)
 
 static GCSpinLock write_barrier_spin_lock;
 
+// Gen2 and UOH regions stay on normal pages with gen0_huge_pages_p, so when a region committed for
+// gen0/gen1 becomes one of those we take back the huge page advice grow_heap_segment gave it.
+void gc_heap::clear_region_huge_pages (heap_segment* region)
+{
+    if (!gen0_huge_pages_p)
+        return;
+
+    uint8_t* region_start = get_region_start (region);
+    if (heap_segment_committed (region) > region_start)
+    {
+        GCToOSInterface::VirtualAdviseHugePages (region_start, (heap_segment_committed (region) - region_start), false);
+    }
+}
+
 inline
 void gc_heap::set_region_gen_num (heap_segment* region, int gen_num)
 {
@@ -12478,6 +12672,12 @@ void gc_heap::init_heap_segment (heap_segment* seg, gc_heap* hp
 #endif //MULTIPLE_HEAPS
 
 #ifdef USE_REGIONS
+    if (existing_region_p && (gen_num >= max_generation))
+    {
+        // a free region that's still committed may have been used for gen0/gen1 before
+        clear_region_huge_pages (seg);
+    }
+
     int gen_num_for_region = min (gen_num, (int)max_generation);
     set_region_gen_num (seg, gen_num_for_region);
     heap_segment_plan_gen_num (seg) = gen_num_for_region;
@@ -12857,6 +13057,17 @@ static int64_t grow_region_list (region_free_list* dest, region_free_list* src,
     return added_count;
 }
 
+#ifdef MULTIPLE_HEAPS
+// the index of the per NUMA node surplus list distribute_free_regions uses for regions trimmed from
+// or given to heap hn - heaps are numbered by node so heaps sharing an index are on the same node.
+static int free_region_node_of_heap (int hn)
+{
+    uint16_t numa_node = heap_select::find_numa_node_from_heap_no (hn);
+    assert (numa_node < MAX_SUPPORTED_NODES);
+    return (int)min (numa_node, (uint16_t)(MAX_SUPPORTED_NODES - 1));
+}
+#endif //MULTIPLE_HEAPS
+
 region_free_list::region_free_list() : num_free_regions (0),
                                        size_free_regions (0),
                                        size_committed_in_free_regions (0),
@@ -13660,6 +13871,11 @@ void gc_heap::distribute_free_regions()
     for (int kind = basic_free_region; kind < count_distributed_free_region_kinds; kind++)
     {
 #ifdef MULTIPLE_HEAPS
+        // Regions trimmed from a heap are kept on a list for the heap's NUMA node, so heaps get regions
+        // that were last used (and usually first touched) on their own node before falling back to the
+        // node agnostic surplus and finally to the surplus of other nodes.
+        region_free_list node_surplus_regions[MAX_SUPPORTED_NODES];
+
         // now go through all the heaps and remove any free regions above the target count
         for (int i = 0; i < n_heaps; i++)
         {
@@ -13674,18 +13890,64 @@ void gc_heap::distribute_free_regions()
                     hp->free_regions[kind].get_num_free_regions(),
                     heap_budget_in_region_units[kind][i]));
 
-                trim_region_list (&surplus_regions[kind], &hp->free_regions[kind], heap_budget_in_region_units[kind][i]);
+                trim_region_list (&node_surplus_regions[free_region_node_of_heap (i)], &hp->free_regions[kind], heap_budget_in_region_units[kind][i]);
+            }
+        }
+        // then go through all the heaps and distribute the surplus regions of their own node, and any
+        // node agnostic ones, to heaps having too few free regions
+        for (int i = 0; i < n_heaps; i++)
+        {
+            gc_heap* hp = g_heaps[i];
+
+            if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[kind][i])
+            {
+                int64_t num_added_regions = grow_region_list (&hp->free_regions[kind], &node_surplus_regions[free_region_node_of_heap (i)], heap_budget_in_region_units[kind][i]);
+                num_added_regions += grow_region_list (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[kind][i]);
+                dprintf (REGIONS_LOG, ("added %zd %s regions to heap %d - now has %zd, budget is %zd",
+                    (size_t)num_added_regions,
+                    free_region_kind_name[kind],
+                    i,
+                    hp->free_regions[kind].get_num_free_regions(),
+                    heap_budget_in_region_units[kind][i]));
             }
         }
-        // finally go through all the heaps and distribute any surplus regions to heaps having too few free regions
+        // finally, only heaps whose node ran out of free regions take the surplus of other nodes
         for (int i = 0; i < n_heaps; i++)
         {
             gc_heap* hp = g_heaps[i];
+            int node = free_region_node_of_heap (i);
+
+            int64_t num_cross_node_regions = 0;
+            for (int other_node = 0; other_node < MAX_SUPPORTED_NODES; other_node++)
+            {
+                if (hp->free_regions[kind].get_num_free_regions() >= heap_budget_in_region_units[kind][i])
+                    break;
+                if (other_node != node)
+                {
+                    num_cross_node_regions += grow_region_list (&hp->free_regions[kind], &node_surplus_regions[other_node], heap_budget_in_region_units[kind][i]);
+                }
+            }
+
+            if (num_cross_node_regions > 0)
+            {
+                dprintf (REGIONS_LOG, ("added %zd %s regions from other nodes to heap %d - now has %zd, budget is %zd",
+                    (size_t)num_cross_node_regions,
+                    free_region_kind_name[kind],
+                    i,
+                    hp->free_regions[kind].get_num_free_regions(),
+                    heap_budget_in_region_units[kind][i]));
+            }
+            hp->free_regions[kind].sort_by_committed_and_age();
+        }
+
+        for (int node = 0; node < MAX_SUPPORTED_NODES; node++)
+        {
+            surplus_regions[kind].transfer_regions (&node_surplus_regions[node]);
+        }
 #else //MULTIPLE_HEAPS
         {
             gc_heap* hp = pGenGCHeap;
             const int i = 0;
-#endif //MULTIPLE_HEAPS
 
             // second pass: fill all the regions having less than budget
             if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[kind][i])
@@ -13700,6 +13962,7 @@ void gc_heap::distribute_free_regions()
             }
             hp->free_regions[kind].sort_by_committed_and_age();
         }
+#endif //MULTIPLE_HEAPS
 
         if (surplus_regions[kind].get_num_free_regions() > 0)
         {
@@ -14469,6 +14732,21 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
     HRESULT hres = S_OK;
 
     conserve_mem_setting = (int)GCConfig::GetGCConserveMem();
+    pause_target = (uint64_t)GCConfig::GetGCPauseTarget() * 1000;
+
+#ifdef MH_SC_MARK
+    mark_steal_threshold = (size_t)GCConfig::GetGCMarkStealThreshold();
+    mark_steal_ephemeral_p = GCConfig::GetGCMarkStealEphemeral();
+#endif //MH_SC_MARK
+
+#ifdef MARK_PHASE_PREFETCH
+    mark_queue_t::init_slot_count ((size_t)GCConfig::GetGCMarkPrefetchDistance());
+#endif //MARK_PHASE_PREFETCH
+
+#ifdef USE_REGIONS
+    // with large pages everything is already backed by large pages up front
+    gen0_huge_pages_p = !use_large_pages_p && GCConfig::GetGCGen0HugePages();
+#endif //USE_REGIONS
 
 #ifdef DYNAMIC_HEAP_COUNT
     dynamic_adaptation_mode = (int)GCConfig::GetGCDynamicAdaptationMode();
@@ -14806,8 +15084,11 @@ gc_heap::init_semi_shared()
 #ifdef FEATURE_LOH_COMPACTION
     loh_compaction_always_p = GCConfig::GetLOHCompactionMode() != 0;
     loh_compaction_mode = loh_compaction_default;
+    loh_compaction_budget = (size_t)GCConfig::GetLOHCompactionBudget();
 #endif //FEATURE_LOH_COMPACTION
 
+    poh_size_classes_p = GCConfig::GetGCPOHSizeClasses();
+
 #ifdef BGC_SERVO_TUNING
     memset (bgc_tuning::gen_calc, 0, sizeof (bgc_tuning::gen_calc));
     memset (bgc_tuning::gen_stats, 0, sizeof (bgc_tuning::gen_stats));
@@ -15765,6 +16046,18 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
 
     size_t c_size = align_on_page ((size_t)(high_address - heap_segment_committed (seg)));
     c_size = max (c_size, commit_min_th);
+
+#ifdef USE_REGIONS
+    bool huge_pages_p = gen0_huge_pages_p && !heap_segment_uoh_p (seg) && (heap_segment_gen_num (seg) < max_generation);
+    if (huge_pages_p)
+    {
+        // commit up to a huge page boundary so the whole huge page can be backed by one when it's touched
+        size_t commit_end = (size_t)heap_segment_committed (seg) + c_size;
+        commit_end = (commit_end + (HUGE_PAGE_SIZE - 1)) & ~(HUGE_PAGE_SIZE - 1);
+        c_size = commit_end - (size_t)heap_segment_committed (seg);
+    }
+#endif //USE_REGIONS
+
     c_size = min (c_size, (size_t)(heap_segment_reserved (seg) - heap_segment_committed (seg)));
 
     if (c_size == 0)
@@ -15777,6 +16070,13 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
     bool ret = virtual_commit (heap_segment_committed (seg), c_size, heap_segment_oh (seg), heap_number, hard_limit_exceeded_p);
     if (ret)
     {
+#ifdef USE_REGIONS
+        if (huge_pages_p)
+        {
+            GCToOSInterface::VirtualAdviseHugePages (heap_segment_committed (seg), c_size, true);
+        }
+#endif //USE_REGIONS
+
         heap_segment_committed (seg) += c_size;
 
         STRESS_LOG1(LF_GC, LL_INFO10000, "New commit: %zx\n",
@@ -17047,6 +17347,11 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size, size_t size,
     }
 #endif //MULTIPLE_HEAPS
 
+    if (gen_number == 0)
+    {
+        acontext->inc_quantum_refill_count();
+    }
+
     dprintf (3, ("Expanding segment allocation [%zx, %zx[", (size_t)start,
                (size_t)start + limit_size - aligned_min_obj_size));
 
@@ -17277,8 +17582,8 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
-size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+size_t gc_heap::limit_from_size (size_t size, alloc_context* acontext, uint32_t flags, size_t physical_limit,
+                                 int gen_number, int align_const)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -17287,7 +17592,7 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? get_allocation_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -17649,7 +17954,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                 // We ask for more Align (min_obj_size)
                 // to make sure that we can insert a free object
                 // in adjust_limit will set the limit lower
-                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
+                size_t limit = limit_from_size (size, acontext, flags, free_list_size, gen_number, align_const);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
                 uint8_t*  remain = (free_list + limit);
@@ -17843,8 +18148,8 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
                 remove_gen_free (gen_number, free_list_size);
 
                 // Subtract min obj size because limit_from_size adds it. Not needed for LOH
-                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
-                                                gen_number, align_const);
+                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), acontext, flags,
+                                                free_list_size, gen_number, align_const);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
                 size_t saved_free_list_size = free_list_size;
@@ -17939,6 +18244,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     if (a_size_fit_p (size, allocated, end, align_const))
     {
         limit = limit_from_size (size,
+                                 acontext,
                                  flags,
                                  (end - allocated),
                                  gen_number, align_const);
@@ -17950,6 +18256,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     if ((heap_segment_reserved (seg) != heap_segment_committed (seg)) && (a_size_fit_p (size, allocated, end, align_const)))
     {
         limit = limit_from_size (size,
+                                 acontext,
                                  flags,
                                  (end - allocated),
                                  gen_number, align_const);
@@ -24403,6 +24710,7 @@ void gc_heap::garbage_collect (int n)
 
     //reset the number of alloc contexts
     alloc_contexts_used = 0;
+    alloc_contexts_unused_bytes = 0;
 
     fix_allocation_contexts (TRUE);
 #ifdef MULTIPLE_HEAPS
@@ -27667,19 +27975,40 @@ BOOL ref_p (uint8_t* r)
     return (straight_ref_p (r) || partial_object_p (r));
 }
 
+#ifdef MARK_PHASE_PREFETCH
+size_t mark_queue_t::slot_count = 16;
+#endif //MARK_PHASE_PREFETCH
+
 mark_queue_t::mark_queue_t()
 #ifdef MARK_PHASE_PREFETCH
     : curr_slot_index(0)
 #endif //MARK_PHASE_PREFETCH
 {
 #ifdef MARK_PHASE_PREFETCH
-    for (size_t i = 0; i < slot_count; i++)
+    for (size_t i = 0; i < max_slot_count; i++)
     {
         slot_table[i] = nullptr;
     }
 #endif //MARK_PHASE_PREFETCH
 }
 
+#ifdef MARK_PHASE_PREFETCH
+// A deeper queue hides more of the memory latency when the heap is much larger than the cache, at the
+// cost of marking objects later, so the right depth depends on the hardware and the shape of the heap.
+void mark_queue_t::init_slot_count (size_t count)
+{
+    count = max ((size_t)1, min (count, (size_t)max_slot_count));
+
+    // round down to a power of 2 so advancing the slot index is just a mask
+    size_t pow2_count = 1;
+    while ((pow2_count * 2) <= count)
+    {
+        pow2_count *= 2;
+    }
+    slot_count = pow2_count;
+}
+#endif //MARK_PHASE_PREFETCH
+
 // place an object in the mark queue
 // returns a *different* object or nullptr
 // if a non-null object is returned, that object is newly marked
@@ -27697,7 +28026,7 @@ uint8_t *mark_queue_t::queue_mark(uint8_t *o)
     uint8_t* old_o = slot_table[slot_index];
     slot_table[slot_index] = o;
 
-    curr_slot_index = (slot_index + 1) % slot_count;
+    curr_slot_index = (slot_index + 1) & (slot_count - 1);
     if (old_o == nullptr)
         return nullptr;
 #else //MARK_PHASE_PREFETCH
@@ -27761,7 +28090,7 @@ uint8_t* mark_queue_t::get_next_marked()
     {
         uint8_t* o = slot_table[slot_index];
         slot_table[slot_index] = nullptr;
-        slot_index = (slot_index + 1) % slot_count;
+        slot_index = (slot_index + 1) & (slot_count - 1);
         if (o != nullptr)
         {
             BOOL already_marked = marked (o);
@@ -27781,7 +28110,7 @@ uint8_t* mark_queue_t::get_next_marked()
 void mark_queue_t::verify_empty()
 {
 #ifdef MARK_PHASE_PREFETCH
-    for (size_t slot_index = 0; slot_index < slot_count; slot_index++)
+    for (size_t slot_index = 0; slot_index < max_slot_count; slot_index++)
     {
         assert(slot_table[slot_index] == nullptr);
     }
@@ -28043,6 +28372,17 @@ int find_next_buddy_heap (int this_heap_number, int current_buddy, int n_heaps)
 void
 gc_heap::mark_steal()
 {
+    // Stealing is done an object at a time so timing each one would cost two high precision timestamps
+    // per object. Instead we only time steals when informational GC events are on, and then per batch of
+    // objects stolen without going idle.
+    bool time_steals_p = false;
+#ifdef FEATURE_EVENT_TRACE
+    time_steals_p = informational_event_enabled_p;
+#endif //FEATURE_EVENT_TRACE
+    uint64_t steal_start_time = (time_steals_p ? GetHighPrecisionTimeStamp() : 0);
+    uint64_t steal_work_time = 0;
+    mark_steal_count = 0;
+
     mark_stack_busy() = 0;
     //clear the mark stack in the snooping range
     for (int i = 0; i < max_snoop_level; i++)
@@ -28066,6 +28406,7 @@ gc_heap::mark_steal()
         gc_heap* hp = g_heaps [thpn];
         int level = first_not_ready_level;
         first_not_ready_level = 0;
+        uint64_t batch_start_time = 0;
 
         while (check_next_mark_stack (hp) && (level < (max_snoop_level-1)))
         {
@@ -28161,7 +28502,12 @@ gc_heap::mark_steal()
                     uint64_t start_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
 #endif //SNOOP_STATS
 
+                    if (time_steals_p && (batch_start_time == 0))
+                    {
+                        batch_start_time = GetHighPrecisionTimeStamp();
+                    }
                     mark_object_simple1 (o, start, heap_number);
+                    mark_steal_count++;
 
 #ifdef SNOOP_STATS
                     dprintf (SNOOP_LOG, ("heap%d: done marking %zx from %d [%d] %dms tl:%dms",
@@ -28193,6 +28539,10 @@ gc_heap::mark_steal()
                 level++;
             }
         }
+        if (batch_start_time != 0)
+        {
+            steal_work_time += GetHighPrecisionTimeStamp() - batch_start_time;
+        }
         if ((first_not_ready_level != 0) && hp->mark_stack_busy())
         {
             continue;
@@ -28237,6 +28587,19 @@ gc_heap::mark_steal()
             }
         }
     }
+
+    mark_steal_idle_time = (time_steals_p ? ((GetHighPrecisionTimeStamp() - steal_start_time) - steal_work_time) : 0);
+    dprintf (3, ("h%d stole %zd mark stack entries, %I64dus marking stolen objects, %I64dus idle",
+        heap_number, mark_steal_count, steal_work_time, mark_steal_idle_time));
+
+#ifdef FEATURE_EVENT_TRACE
+    GCEventFireMarkSteal_V1 (
+        (uint64_t)settings.gc_index,
+        (uint32_t)heap_number,
+        (uint64_t)mark_steal_count,
+        (uint64_t)steal_work_time,
+        (uint64_t)mark_steal_idle_time);
+#endif //FEATURE_EVENT_TRACE
 }
 
 inline
@@ -28693,6 +29056,13 @@ next_level:
         {
             oo = *(--background_mark_stack_tos);
 
+            // The entry below is what we pop next unless oo has children to push, start bringing it in
+            // while we go through oo's references.
+            if (background_mark_stack_tos != background_mark_stack_array)
+            {
+                Prefetch (background_mark_stack_tos[-1]);
+            }
+
 #ifdef SORT_MARK_STACK
             sorted_tos = (uint8_t**)min ((size_t)sorted_tos, (size_t)background_mark_stack_tos);
 #endif //SORT_MARK_STACK
@@ -30173,11 +30543,11 @@ void gc_heap::mark_phase (int condemned_gen_number)
 
 #ifdef MULTIPLE_HEAPS
 #ifdef MH_SC_MARK
-        if (full_p)
+        if (full_p || mark_steal_ephemeral_p)
         {
             size_t total_heap_size = get_total_heap_size();
 
-            if (total_heap_size > (100 * 1024 * 1024))
+            if (total_heap_size > mark_steal_threshold)
             {
                 do_mark_steal_p = TRUE;
             }
@@ -31749,6 +32119,7 @@ BOOL gc_heap::plan_loh()
     uint8_t* free_space_start = o;
     uint8_t* free_space_end = o;
     uint8_t* new_address = 0;
+    size_t moved_size = 0;
 
     while (1)
     {
@@ -31781,9 +32152,24 @@ BOOL gc_heap::plan_loh()
                 }
                 new_address = o;
             }
+            else if (loh_compaction_budget && (moved_size >= loh_compaction_budget))
+            {
+                // We are over the budget, so this and all the following objects stay where they are. They are
+                // handled exactly like pinned objects so compact_loh threads the free space in front of them.
+                set_pinned (o);
+                if (!loh_enque_pinned_plug (o, size))
+                {
+                    return FALSE;
+                }
+                new_address = o;
+            }
             else
             {
                 new_address = loh_allocate_in_condemned (size);
+                if (new_address != o)
+                {
+                    moved_size += size;
+                }
             }
 
             loh_set_node_relocation_distance (o, (new_address - o));
@@ -31806,6 +32192,8 @@ BOOL gc_heap::plan_loh()
         }
     }
 
+    dprintf (1235, ("h%d moving %zd bytes of LOH objects, budget %zd", heap_number, moved_size, loh_compaction_budget));
+
     while (!loh_pinned_plug_que_empty_p())
     {
         mark* m = loh_pinned_plug_of (loh_deque_pinned_plug());
@@ -31966,7 +32354,10 @@ void gc_heap::compact_loh()
                 loh_pad = AlignQword (loh_padding_obj_size);
 
                 reloc += loh_node_relocation_distance (o);
-                gcmemcopy (reloc, o, size, TRUE);
+                if (reloc != o)
+                {
+                    gcmemcopy (reloc, o, size, TRUE);
+                }
             }
 
             thread_gap ((reloc - loh_pad), loh_pad, gen);
@@ -35252,6 +35643,12 @@ heap_segment* gc_heap::find_first_valid_region (heap_segment* region, bool compa
                 decommit_heap_segment_pages (current_region, 0);
             }
 
+            if ((gen_num < soh_gen2) && (plan_gen_num >= soh_gen2))
+            {
+                // promoted in place, so it was committed (and advised) as a gen0/gen1 region
+                clear_region_huge_pages (current_region);
+            }
+
             dprintf (REGIONS_LOG, ("  set region %p(%p) gen num to %d",
                 current_region, heap_segment_mem (current_region), plan_gen_num));
             set_region_gen_num (current_region, plan_gen_num);
@@ -38433,6 +38830,54 @@ uint8_t* gc_heap::get_start_address (heap_segment* seg)
     return start;
 }
 
+#if defined(BACKGROUND_GC) && !defined(USE_REGIONS)
+// With segments the mark array is only committed for the segments a BGC needs it for (see
+// commit_mark_array_new_seg), the rest of its bookkeeping element is just reserved. This adds up the
+// pages committed for it the same way commit_mark_array_by_range rounds them, so a page shared by
+// two adjacent segments is counted twice.
+size_t gc_heap::get_committed_mark_array_size()
+{
+    size_t committed = 0;
+
+#ifdef MULTIPLE_HEAPS
+    for (int h = 0; h < n_heaps; h++)
+    {
+        gc_heap* hp = g_heaps[h];
+#else
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        for (int i = get_start_generation_index(); (hp->mark_array != nullptr) && (i < total_generation_count); i++)
+        {
+            heap_segment* seg = heap_segment_in_range (generation_start_segment (hp->generation_of (i)));
+            while (seg)
+            {
+                if (seg->flags & (heap_segment_flags_ma_committed | heap_segment_flags_ma_pcommitted))
+                {
+                    uint8_t* start = get_start_address (seg);
+                    uint8_t* end = heap_segment_reserved (seg);
+                    if (seg->flags & heap_segment_flags_ma_pcommitted)
+                    {
+                        start = max (hp->background_saved_lowest_address, start);
+                        end = min (hp->background_saved_highest_address, end);
+                    }
+
+                    if (start < end)
+                    {
+                        uint8_t* commit_start = align_lower_page ((uint8_t*)&hp->mark_array[mark_word_of (start)]);
+                        uint8_t* commit_end = align_on_page ((uint8_t*)&hp->mark_array[mark_word_of (align_on_mark_word (end))]);
+                        committed += (size_t)(commit_end - commit_start);
+                    }
+                }
+                seg = heap_segment_next_in_range (seg);
+            }
+        }
+    }
+
+    return committed;
+}
+#endif //BACKGROUND_GC && !USE_REGIONS
+
 BOOL gc_heap::commit_mark_array_new_seg (gc_heap* hp,
                                          heap_segment* seg,
                                          uint32_t* new_card_table,
@@ -41800,6 +42245,43 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Returns the first non-zero word in [card_word, card_word_end), or card_word_end if they are all zero.
+// In ephemeral GCs on big heaps most card words are zero, so this checks 16 words at a time with
+// the SIMD instructions that are always available on the platform (SSE2 on x64 and AdvSimd on arm64).
+// The card and card bundle tables are both arrays of 32-bit words.
+inline
+uint32_t* find_non_zero_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
+    const size_t words_per_step = 16;
+
+    while ((size_t)(card_word_end - card_word) >= words_per_step)
+    {
+#ifdef TARGET_AMD64
+        __m128i v = _mm_or_si128 (_mm_or_si128 (_mm_loadu_si128 ((__m128i*)card_word), _mm_loadu_si128 ((__m128i*)(card_word + 4))),
+                                  _mm_or_si128 (_mm_loadu_si128 ((__m128i*)(card_word + 8)), _mm_loadu_si128 ((__m128i*)(card_word + 12))));
+        bool non_zero_p = (_mm_movemask_epi8 (_mm_cmpeq_epi32 (v, _mm_setzero_si128())) != 0xFFFF);
+#else //TARGET_AMD64
+        uint32x4_t v = vorrq_u32 (vorrq_u32 (vld1q_u32 (card_word), vld1q_u32 (card_word + 4)),
+                                  vorrq_u32 (vld1q_u32 (card_word + 8), vld1q_u32 (card_word + 12)));
+        bool non_zero_p = (vmaxvq_u32 (v) != 0);
+#endif //TARGET_AMD64
+
+        if (non_zero_p)
+        {
+            break;
+        }
+        card_word += words_per_step;
+    }
+#endif //TARGET_AMD64 || TARGET_ARM64
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -41827,6 +42309,14 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
                 else
                 {
                     cardb += sizeof(cbw)*8 - card_bundle_bit (cardb);
+
+                    // skip the following all zero bundle words in bulk
+                    if (cardb < end_cardb)
+                    {
+                        uint32_t* cb_word = &card_bundle_table[card_bundle_word (cardb)];
+                        uint32_t* cb_word_end = &card_bundle_table[card_bundle_word (end_cardb - 1) + 1];
+                        cardb += (find_non_zero_card_word (cb_word, cb_word_end) - cb_word) * sizeof(cbw)*8;
+                    }
                 }
             }
             if (cardb >= end_cardb)
@@ -41834,10 +42324,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -41851,10 +42338,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -41874,15 +42358,11 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
-        while (card_word < card_word_end)
+        card_word = find_non_zero_card_word (card_word, card_word_end);
+        if (card_word < card_word_end)
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -41942,12 +42422,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_non_zero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -44499,6 +44974,15 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
                     }
                 }
             }
+
+            if ((gen_number == 0) && (pause_target_gen0_budget_factor < 1.0f))
+            {
+                // less allocation between GCs means less to promote, which is what most of an ephemeral GC's pause is
+                size_t reduced_allocation = max ((size_t)(new_allocation * pause_target_gen0_budget_factor), min_gc_size);
+                dprintf (2, ("Reducing gen0 new allocation by %.3f for the pause target from %zd to %zd",
+                    pause_target_gen0_budget_factor, new_allocation, min (new_allocation, reduced_allocation)));
+                new_allocation = min (new_allocation, reduced_allocation);
+            }
         }
 
         size_t new_allocation_ret = Align (new_allocation, get_alignment_constant (gen_number <= max_generation));
@@ -45964,6 +46448,42 @@ BOOL gc_heap::ephemeral_gen_fit_p (gc_tuning_point tp)
     }
 }
 
+// Pinned buffers are usually allocated and freed over and over again in a few sizes. If each one takes
+// up exactly its own size, a freed space gets reused by a slightly smaller buffer and what's left
+// over is often too small for anything, so the POH fragments. Instead we make the POH allocations in
+// this range take up the next power of 2 with the rest as a free object right after the object. When
+// the object dies the sweep coalesces it with that free object (and any free space around them), so
+// the free space it leaves is at least its size class and the next buffer of the same size class can
+// take it without splitting off a small leftover. Sizes above half of the smallest class are rounded
+// up, so the smallest class gets objects larger than 2KB. A size whose rest would be too small for a
+// free object is not rounded up.
+#define POH_SIZE_CLASS_MIN (4*1024)
+#define POH_SIZE_CLASS_MAX (64*1024)
+
+inline
+size_t poh_size_class_of (size_t size)
+{
+    if ((size <= POH_SIZE_CLASS_MIN / 2) || (size > POH_SIZE_CLASS_MAX))
+    {
+        return size;
+    }
+
+    size_t class_size = POH_SIZE_CLASS_MIN;
+    while (class_size < size)
+    {
+        class_size *= 2;
+    }
+
+    // the rest needs to be big enough for a free object
+    size_t rest = class_size - size;
+    if ((rest != 0) && (rest < Align (min_obj_size)))
+    {
+        return size;
+    }
+
+    return class_size;
+}
+
 CObjectHeader* gc_heap::allocate_uoh_object (size_t jsize, uint32_t flags, int gen_number, int64_t& alloc_bytes)
 {
     alloc_context acontext;
@@ -45995,10 +46515,17 @@ CObjectHeader* gc_heap::allocate_uoh_object (size_t jsize, uint32_t flags, int g
 #endif //FEATURE_LOH_COMPACTION
 
     assert (size >= Align (min_obj_size, align_const));
+
+    size_t alloc_size = size;
+    if (poh_size_classes_p && (gen_number == poh_generation))
+    {
+        alloc_size = poh_size_class_of (size);
+    }
+
 #ifdef _MSC_VER
 #pragma inline_depth(0)
 #endif //_MSC_VER
-    if (! allocate_more_space (&acontext, (size + pad), flags, gen_number))
+    if (! allocate_more_space (&acontext, (alloc_size + pad), flags, gen_number))
     {
         return 0;
     }
@@ -46014,9 +46541,20 @@ CObjectHeader* gc_heap::allocate_uoh_object (size_t jsize, uint32_t flags, int g
 
     uint8_t*  result = acontext.alloc_ptr;
 
-    assert ((size_t)(acontext.alloc_limit - acontext.alloc_ptr) == size);
+    assert ((size_t)(acontext.alloc_limit - acontext.alloc_ptr) == alloc_size);
     alloc_bytes += size;
 
+    if (alloc_size != size)
+    {
+        // This needs to be done before the object is published so a BGC can't look at it in between.
+        // Like any other free space in POH this is only counted (in the free list or free obj space)
+        // by the next GC that sweeps POH. That's the single place it's accounted for - counting it here
+        // as well would count it twice whenever that sweep, including a background one, finds it.
+        size_t rest = alloc_size - size;
+        make_unused_array (result + size, rest);
+        dprintf (3, ("POH obj %p of %zd bytes takes up %zd", result, size, alloc_size));
+    }
+
     CObjectHeader* obj = (CObjectHeader*)result;
 
     assert (obj != 0);
@@ -46169,6 +46707,51 @@ BOOL gc_heap::background_object_marked (uint8_t* o, BOOL clearp)
     return m;
 }
 
+#ifdef USE_REGIONS
+// Returns TRUE if any object starting in [start, end[ is marked in the mark array.
+// This only reads the mark array so it's much cheaper than walking the objects
+// in the range.
+BOOL gc_heap::background_range_has_marked_objects_p (uint8_t* start, uint8_t* end)
+{
+    assert (start < end);
+
+    if ((start < background_saved_lowest_address) || (end > background_saved_highest_address))
+    {
+        // objects outside of the BGC range are considered marked
+        return TRUE;
+    }
+
+    size_t startwrd = mark_word_of (start);
+    size_t endwrd = mark_word_of (end - 1);
+    unsigned int startbit = (unsigned int)mark_bit_bit_of (start);
+    unsigned int endbit = (unsigned int)mark_bit_bit_of (end - 1);
+
+    // bits at or above startbit, and at or below endbit
+    uint32_t firstwrd = ~0u << startbit;
+    uint32_t lastwrd = ~0u >> (mark_word_width - 1 - endbit);
+
+    if (startwrd == endwrd)
+    {
+        return ((mark_array[startwrd] & firstwrd & lastwrd) != 0);
+    }
+
+    if ((mark_array[startwrd] & firstwrd) != 0)
+    {
+        return TRUE;
+    }
+
+    for (size_t wrd = startwrd + 1; wrd < endwrd; wrd++)
+    {
+        if (mark_array[wrd] != 0)
+        {
+            return TRUE;
+        }
+    }
+
+    return ((mark_array[endwrd] & lastwrd) != 0);
+}
+#endif //USE_REGIONS
+
 void gc_heap::background_delay_delete_uoh_segments()
 {
     for (int i = uoh_start_generation; i < total_generation_count; i++)
@@ -46911,6 +47494,20 @@ void gc_heap::background_sweep()
                             (size_t)heap_segment_allocated (seg),
                             (size_t)heap_segment_background_allocated (seg)));
 
+#ifdef USE_REGIONS
+            // If nothing in this region survived we don't need to walk its objects - the
+            // whole region is one gap that process_background_segment_end will either
+            // thread (if there are objects promoted into it during this BGC) or free.
+            // This is only valid when we don't need to unlink existing free list items
+            // in the region, ie, when the free list of this generation is rebuilt.
+            if (((i > max_generation) || rebuild_maxgen_fl_p) && (o < end) &&
+                !background_range_has_marked_objects_p (o, end))
+            {
+                dprintf (3333, ("bgs: seg: %zx has no marked objects, skipping", (size_t)seg));
+                o = end;
+            }
+#endif //USE_REGIONS
+
             while (o < end)
             {
                 if (background_object_marked (o, TRUE))
@@ -51298,6 +51895,46 @@ void gc_heap::update_recorded_gen_data (last_recorded_gc_info* gc_info)
     }
 }
 
+// Gen2 GCs are not what the pause target is for - full blocking GCs can't be made shorter by a smaller
+// gen0 budget and BGCs only pause briefly anyway. This is called with the pause (in us) of a blocking
+// ephemeral GC and adjusts the gen0 budget the next GCs will compute.
+void gc_heap::update_pause_target_budget_factor (size_t pause_duration)
+{
+    // don't let the budget go below 1/16 of what it would be without a target, at that point we are
+    // better off doing fewer GCs even if they miss the target
+    const float min_factor = 1.0f / 16.0f;
+    float old_factor = pause_target_gen0_budget_factor;
+
+    if (pause_duration > pause_target)
+    {
+        pause_target_miss_count++;
+
+        // pauses are roughly proportional to what survives, so reduce by how much we missed by,
+        // but at most halve it at a time since a single GC can be an outlier
+        float ratio = max ((float)pause_target / (float)pause_duration, 0.5f);
+        pause_target_gen0_budget_factor = max (pause_target_gen0_budget_factor * ratio, min_factor);
+
+#ifdef FEATURE_EVENT_TRACE
+        GCEventFirePauseTargetMiss_V1 (
+            (uint64_t)settings.gc_index,
+            (uint16_t)settings.condemned_generation,
+            (uint64_t)pause_duration,
+            (uint64_t)pause_target,
+            (uint64_t)pause_target_miss_count,
+            (float)pause_target_gen0_budget_factor);
+#endif //FEATURE_EVENT_TRACE
+    }
+    else if (pause_duration < (pause_target / 2))
+    {
+        // well under the target, slowly give the budget back
+        pause_target_gen0_budget_factor = min (pause_target_gen0_budget_factor * 1.1f, 1.0f);
+    }
+
+    dprintf (6666, ("GC#%zd gen%d pause %zdus, target %I64dus, %zd misses, gen0 budget factor %.3f -> %.3f",
+        (size_t)settings.gc_index, settings.condemned_generation, pause_duration, pause_target,
+        pause_target_miss_count, old_factor, pause_target_gen0_budget_factor));
+}
+
 void gc_heap::do_post_gc()
 {
 #ifdef MULTIPLE_HEAPS
@@ -51416,6 +52053,11 @@ void gc_heap::do_post_gc()
         last_gc_info->pause_durations[0] = pause_duration;
         total_suspended_time += pause_duration;
         last_gc_info->pause_durations[1] = 0;
+
+        if (pause_target && (settings.condemned_generation < max_generation))
+        {
+            update_pause_target_budget_factor (pause_duration);
+        }
     }
 
     uint64_t total_process_time = end_gc_time - process_start_time;
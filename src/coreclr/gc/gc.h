@@ -219,6 +219,38 @@ void record_global_mechanism (int mech_index);
 
 struct alloc_context : gc_alloc_context
 {
+    // How the alloc_quantum_info field is organized -
+    //
+    // high 16-bits are the (signed) log2 of the factor the allocation quantum is scaled by for this context.
+    // low 16-bits are the number of times this context got a new allocation quantum since it was last adapted.
+    inline void init_quantum_refill_count()
+    {
+        alloc_quantum_info &= 0xffff0000;
+    }
+
+    inline uint16_t get_quantum_refill_count()
+    {
+        return (uint16_t)alloc_quantum_info;
+    }
+
+    inline void inc_quantum_refill_count()
+    {
+        if ((alloc_quantum_info & 0xffff) != 0xffff)
+        {
+            alloc_quantum_info++;
+        }
+    }
+
+    inline int get_quantum_shift()
+    {
+        return (alloc_quantum_info >> 16);
+    }
+
+    inline void set_quantum_shift (int shift)
+    {
+        alloc_quantum_info = (int)(((uint32_t)shift << 16) | (alloc_quantum_info & 0xffff));
+    }
+
 #ifdef FEATURE_SVR_GC
     inline SVR::GCHeap* get_alloc_heap()
     {
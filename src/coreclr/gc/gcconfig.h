@@ -79,6 +79,7 @@ public:
     BOOL_CONFIG  (GCLargePages,              "GCLargePages",              "System.GC.LargePages",              false,              "Enables using Large Pages in the GC")                                                     \
     INT_CONFIG   (HeapVerifyLevel,           "HeapVerify",                NULL,                                HEAPVERIFY_NONE,    "When set verifies the integrity of the managed heap on entry and exit of each GC")       \
     INT_CONFIG   (LOHCompactionMode,         "GCLOHCompact",              NULL,                                0,                  "Specifies the LOH compaction mode")                                                      \
+    INT_CONFIG   (LOHCompactionBudget,       "GCLOHCompactBudget",        NULL,                                0,                  "Specifies the max bytes of LOH objects each heap moves in a compacting GC, 0 means no limit")\
     INT_CONFIG   (LOHThreshold,              "GCLOHThreshold",            "System.GC.LOHThreshold",            LARGE_OBJECT_SIZE,  "Specifies the size that will make objects go on LOH")                                    \
     INT_CONFIG   (BGCSpinCount,              "BGCSpinCount",              NULL,                                140,                "Specifies the bgc spin count")                                                           \
     INT_CONFIG   (BGCSpin,                   "BGCSpin",                   NULL,                                2,                  "Specifies the bgc spin time")                                                            \
@@ -134,7 +135,7 @@ public:
     INT_CONFIG   (GCHeapHardLimitSOHPercent, "GCHeapHardLimitSOHPercent", "System.GC.HeapHardLimitSOHPercent", 0,                  "Specifies the GC heap SOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitLOHPercent, "GCHeapHardLimitLOHPercent", "System.GC.HeapHardLimitLOHPercent", 0,                  "Specifies the GC heap LOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitPOHPercent, "GCHeapHardLimitPOHPercent", "System.GC.HeapHardLimitPOHPercent", 0,                  "Specifies the GC heap POH usage as a percentage of the total memory")                    \
-    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F")\
+    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2/AVX512F (x64) or AdvSimd (arm64) - 0 for none, 1 for AVX2 or AdvSimd, 3 for AVX512F")\
     INT_CONFIG   (GCConserveMem,             "GCConserveMemory",          "System.GC.ConserveMemory",          0,                  "Specifies how hard GC should try to conserve memory - values 0-9")                       \
     INT_CONFIG   (GCWriteBarrier,            "GCWriteBarrier",            NULL,                                0,                  "Specifies whether GC should use more precise but slower write barrier")                  \
     STRING_CONFIG(GCName,                    "GCName",                    "System.GC.Name",                                        "Specifies the name of the standalone GC implementation.")                                \
@@ -143,6 +144,12 @@ public:
     INT_CONFIG   (GCDynamicAdaptationMode,   "GCDynamicAdaptationMode",   "System.GC.DynamicAdaptationMode",   1,                  "Enable the GC to dynamically adapt to application sizes.")                               \
     INT_CONFIG   (GCDTargetTCP,              "GCDTargetTCP",              "System.GC.DTargetTCP",              0,                  "Specifies the target tcp for DATAS")                                                     \
     INT_CONFIG   (GCDBGCRatio,               "GCDBGCRatio",               NULL,                                0,                  "Specifies the ratio of BGC to NGC2 for HC change")                                       \
+    INT_CONFIG   (GCMarkStealThreshold,      "GCMarkStealThreshold",      NULL,                                100*1024*1024,      "Specifies the total heap size above which Server GC threads steal mark work from each other")\
+    BOOL_CONFIG  (GCMarkStealEphemeral,      "GCMarkStealEphemeral",      NULL,                                false,              "Specifies whether Server GC threads also steal mark work from each other in ephemeral GCs")\
+    BOOL_CONFIG  (GCGen0HugePages,           "GCGen0HugePages",           NULL,                                false,              "Specifies whether memory committed for gen0 and gen1 regions is backed by transparent huge pages")\
+    INT_CONFIG   (GCMarkPrefetchDistance,    "GCMarkPrefetchDistance",    NULL,                                16,                 "Specifies how many objects the mark phase prefetches ahead of marking them, rounded down to a power of 2 from 1 to 64")\
+    INT_CONFIG   (GCPauseTarget,             "GCPauseTarget",             "System.GC.PauseTarget",             0,                  "Specifies a target in ms for blocking ephemeral GC pauses, the gen0 budget is reduced to try to stay under it")\
+    BOOL_CONFIG  (GCPOHSizeClasses,          "GCPOHSizeClasses",          "System.GC.POHSizeClasses",          false,              "Specifies whether POH allocations larger than 2KB and up to 64KB are rounded up to a power of 2 so freed spaces get reused without being split")\
     BOOL_CONFIG  (GCCacheSizeFromSysConf,    "GCCacheSizeFromSysConf",    NULL,                                false,              "Specifies using sysconf to retrieve the last level cache size for Unix.")
 
 // This class is responsible for retreiving configuration information
@@ -52,6 +52,10 @@ DYNAMIC_EVENT(CommittedUsage, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationTuning, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationFullGCTuning, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationSample, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(MarkSteal, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(PauseTargetMiss, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(AllocContextsUnused, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(BookkeepingUsage, GCEventLevel_Information, GCEventKeyword_GC, 1)
 
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
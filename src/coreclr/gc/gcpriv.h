@@ -1488,14 +1488,22 @@ enum bookkeeping_element
 class mark_queue_t
 {
 #ifdef MARK_PHASE_PREFETCH
-    static const size_t slot_count = 16;
-    uint8_t* slot_table[slot_count];
+    static const size_t max_slot_count = 64;
+    uint8_t* slot_table[max_slot_count];
     size_t curr_slot_index;
+
+    // How many slots are used, i.e. how many objects are in flight being prefetched.
+    // This is a power of 2 and set from GCMarkPrefetchDistance at init time.
+    static size_t slot_count;
 #endif //MARK_PHASE_PREFETCH
 
 public:
     mark_queue_t();
 
+#ifdef MARK_PHASE_PREFETCH
+    static void init_slot_count (size_t count);
+#endif //MARK_PHASE_PREFETCH
+
     uint8_t *queue_mark(uint8_t *o);
     uint8_t *queue_mark(uint8_t *o, int condemned_gen);
 
@@ -1638,6 +1646,10 @@ private:
     PER_HEAP_ISOLATED_METHOD void fire_pevents();
 
     PER_HEAP_ISOLATED_METHOD void fire_committed_usage_event();
+    PER_HEAP_ISOLATED_METHOD void fire_bookkeeping_usage_event (size_t total_bookkeeping_committed);
+#if defined(BACKGROUND_GC) && !defined(USE_REGIONS)
+    PER_HEAP_ISOLATED_METHOD size_t get_committed_mark_array_size();
+#endif //BACKGROUND_GC && !USE_REGIONS
 
 #ifdef FEATURE_BASICFREEZE
     PER_HEAP_ISOLATED_METHOD void walk_read_only_segment(heap_segment *seg, void *pvContext, object_callback_func pfnMethodTable, object_callback_func pfnObjRef);
@@ -1672,6 +1684,7 @@ private:
     PER_HEAP_METHOD void check_seg_gen_num (heap_segment* seg);
     PER_HEAP_ISOLATED_METHOD int get_region_gen_num (uint8_t* obj);
     PER_HEAP_ISOLATED_METHOD void set_region_gen_num (heap_segment* region, int gen_num);
+    PER_HEAP_ISOLATED_METHOD void clear_region_huge_pages (heap_segment* region);
     PER_HEAP_ISOLATED_METHOD int get_region_plan_gen_num (uint8_t* obj);
     PER_HEAP_ISOLATED_METHOD bool is_region_demoted (uint8_t* obj);
     PER_HEAP_METHOD void set_region_plan_gen_num (heap_segment* region, int plan_gen_num, bool replace_p = false);
@@ -1819,6 +1832,8 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void do_post_gc();
 
+    PER_HEAP_ISOLATED_METHOD void update_pause_target_budget_factor (size_t pause_duration);
+
     PER_HEAP_ISOLATED_METHOD void update_recorded_gen_data (last_recorded_gc_info* gc_info);
 
     PER_HEAP_METHOD void update_end_gc_time_per_heap();
@@ -2269,8 +2284,10 @@ private:
                           size_t& current_promoted_bytes,
                           size_t& last_promoted_bytes);
 
-    PER_HEAP_METHOD size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+    PER_HEAP_METHOD size_t limit_from_size (size_t size, alloc_context* acontext, uint32_t flags, size_t room,
+                            int gen_number, int align_const);
+    PER_HEAP_ISOLATED_METHOD size_t get_allocation_quantum (alloc_context* acontext);
+    PER_HEAP_ISOLATED_METHOD void adapt_allocation_quantum (alloc_context* acontext);
     PER_HEAP_METHOD allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
                                               int alloc_generation_number);
     PER_HEAP_ISOLATED_METHOD BOOL allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
@@ -2767,6 +2784,9 @@ private:
     PER_HEAP_METHOD void background_mark_simple1 (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP_ISOLATED_METHOD void background_promote (Object**, ScanContext* , uint32_t);
     PER_HEAP_METHOD BOOL background_object_marked (uint8_t* o, BOOL clearp);
+#ifdef USE_REGIONS
+    PER_HEAP_METHOD BOOL background_range_has_marked_objects_p (uint8_t* start, uint8_t* end);
+#endif //USE_REGIONS
     PER_HEAP_METHOD void init_background_gc();
     PER_HEAP_METHOD uint8_t* background_next_end (heap_segment*, BOOL);
     // while we are in LOH sweep we can't modify the segment list
@@ -3518,6 +3538,8 @@ private:
     PER_HEAP_FIELD_SINGLE_GC uint8_t* max_overflow_address;
 
     PER_HEAP_FIELD_SINGLE_GC size_t alloc_contexts_used;
+    // Bytes left unused in allocation contexts that we had to turn into free objects when fixing them for this GC.
+    PER_HEAP_FIELD_SINGLE_GC size_t alloc_contexts_unused_bytes;
 
     // When we decide if we should expand the heap or not, we are
     // fine NOT to expand if we find enough free space in gen0's free
@@ -3593,6 +3615,13 @@ private:
     PER_HEAP_FIELD_SINGLE_GC snoop_stats_data snoop_stat;
 #endif //SNOOP_STATS
 
+#ifdef MH_SC_MARK
+    // Number of mark stack entries this heap stole from other heaps in mark_steal
+    // and the time (in us) it spent there without any work to steal.
+    PER_HEAP_FIELD_SINGLE_GC size_t mark_steal_count;
+    PER_HEAP_FIELD_SINGLE_GC uint64_t mark_steal_idle_time;
+#endif //MH_SC_MARK
+
 #ifdef BGC_SERVO_TUNING
     PER_HEAP_FIELD_SINGLE_GC size_t     bgc_maxgen_end_fl_size;
 #endif //BGC_SERVO_TUNING
@@ -4310,6 +4339,15 @@ private:
     // The elements of this array are updated as each type of GC happens.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t full_gc_counts[gc_type_max];
 
+    // When there's a pause target this is what we scale the gen0 budget by. It goes down when blocking
+    // ephemeral GCs take longer than the target and back up to 1 when they are well under it.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED float pause_target_gen0_budget_factor;
+
+    // Total of alloc_contexts_unused_bytes across all heaps and GCs so far.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED uint64_t total_alloc_contexts_unused_bytes;
+    // The number of blocking ephemeral GCs that took longer than the pause target.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t pause_target_miss_count;
+
     // A provisional mode means we could change our mind in the middle of a GC
     // and want to do a different GC instead.
     //
@@ -5271,6 +5309,24 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int generation_skip_ratio_threshold;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int conserve_mem_setting;
 
+    // Target in us for the pause of blocking ephemeral GCs (GCPauseTarget), 0 if there's none.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint64_t pause_target;
+
+#ifdef MH_SC_MARK
+    // Total heap size above which GC threads steal mark work from each other
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t mark_steal_threshold;
+    // Whether mark stealing is also done for ephemeral GCs
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool mark_steal_ephemeral_p;
+#endif //MH_SC_MARK
+
+#ifdef USE_REGIONS
+    // Indicates to commit gen0/gen1 regions in huge page units and advise the OS to back them with
+    // transparent huge pages. Unlike use_large_pages_p this does not need a hard limit or commit anything
+    // up front. The advice is taken back when a region becomes gen2 or UOH (see clear_region_huge_pages),
+    // though huge pages already backing it are not split.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool gen0_huge_pages_p;
+#endif //USE_REGIONS
+
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool spin_count_unit_config_p;
 
     // For SOH we always allocate segments of the same size (except for segments when no_gc_region requires larger ones).
@@ -5388,8 +5444,17 @@ private:
 #ifdef FEATURE_LOH_COMPACTION
     // This is for forced LOH compaction via the complus env var
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY BOOL        loh_compaction_always_p;
+
+    // Max bytes of LOH objects each heap moves in a compacting GC, 0 means no limit. Once a heap
+    // used up its budget the rest of its LOH objects stay where they are, so a compaction of a big LOH
+    // is spread over several GCs instead of being done in one long pause.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t      loh_compaction_budget;
 #endif //FEATURE_LOH_COMPACTION
 
+    // If this is true POH allocations within the size class range take up all of their size class,
+    // see poh_size_class_of.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool        poh_size_classes_p;
+
 #ifdef HOST_64BIT
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t youngest_gen_desired_th;
 #endif //HOST_64BIT
@@ -6228,9 +6293,9 @@ public:
     //
     // swept_in_plan_p can be folded into gen_num.
     bool            swept_in_plan_p;
-    int             plan_gen_num;
-    int             old_card_survived;
-    int             pinned_survived;
+    // There's one of these per basic region in the seg mapping table so keep the small fields
+    // together - plan_gen_num is -1 or a generation number.
+    int8_t          plan_gen_num;
     // at the end of each GC, we increase each region in the region free list
     // by 1. So we can observe if a region stays in the free list over many
     // GCs. We stop at 99. It's initialized to 0 when a region is added to
@@ -6239,7 +6304,9 @@ public:
     #define AGE_IN_FREE_TO_DECOMMIT_BASIC 20
     #define AGE_IN_FREE_TO_DECOMMIT_LARGE 5
     #define AGE_IN_FREE_TO_DECOMMIT_HUGE 2
-    int             age_in_free;
+    uint8_t         age_in_free;
+    int             old_card_survived;
+    int             pinned_survived;
     // This is currently only used by regions that are swept in plan -
     // we then thread this list onto the generation's free list.
     // We may keep per region free list later which requires more work.
@@ -6663,12 +6730,12 @@ bool& heap_segment_swept_in_plan (heap_segment* inst)
     return inst->swept_in_plan_p;
 }
 inline
-int& heap_segment_plan_gen_num (heap_segment* inst)
+int8_t& heap_segment_plan_gen_num (heap_segment* inst)
 {
     return inst->plan_gen_num;
 }
 inline
-int& heap_segment_age_in_free (heap_segment* inst)
+uint8_t& heap_segment_age_in_free (heap_segment* inst)
 {
     return inst->age_in_free;
 }
@@ -20,6 +20,16 @@
 // result we need to maintain a context between all the DH scanning methods called during a single mark phase.
 // The structure below describes this context. We allocate one of these per GC heap at Ref_Initialize time and
 // select between them based on the ScanContext passed to us by the GC during the mark phase.
+//
+// To avoid walking the whole dependent handle table on every re-scan, a non-concurrent scan of the table also
+// records the handles it found with an unpromoted primary. Subsequent re-scans during the same mark phase only
+// look at those, dropping each one as soon as its primary is promoted.
+struct DhPendingHandle
+{
+    Object        **m_pPrimary;
+    Object        **m_pSecondary;
+};
+
 struct DhContext
 {
     bool            m_fUnpromotedPrimaries;     // Did last scan find at least one non-null unpromoted primary?
@@ -28,6 +38,11 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    bool            m_fRecordPending;           // Is the current table scan recording unpromoted primaries?
+    bool            m_fPendingValid;            // Does m_pPending hold all handles with an unpromoted primary?
+    DhPendingHandle *m_pPending;                // Handles with an unpromoted primary as of the last scan
+    size_t          m_cPending;                 // Number of entries used in m_pPending
+    size_t          m_cPendingCapacity;         // Number of entries allocated for m_pPending
 };
 
 class GCScan
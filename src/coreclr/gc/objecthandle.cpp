@@ -227,6 +227,37 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
+// Records a dependent handle whose primary wasn't promoted for the re-scans. If we fail to grow the list we
+// just stop recording and the re-scans will walk the whole table like they would without it.
+static void DhAddPendingHandle(DhContext *pDhContext, Object **pPrimaryRef, Object **pSecondaryRef)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pDhContext->m_cPending == pDhContext->m_cPendingCapacity)
+    {
+        size_t cNewCapacity = (pDhContext->m_cPendingCapacity == 0) ? 1024 : (pDhContext->m_cPendingCapacity * 2);
+        DhPendingHandle *pNewPending = new (nothrow) DhPendingHandle[cNewCapacity];
+        if (pNewPending == NULL)
+        {
+            pDhContext->m_fRecordPending = false;
+            return;
+        }
+
+        if (pDhContext->m_pPending != NULL)
+        {
+            memcpy(pNewPending, pDhContext->m_pPending, pDhContext->m_cPending * sizeof(DhPendingHandle));
+            delete [] pDhContext->m_pPending;
+        }
+
+        pDhContext->m_pPending = pNewPending;
+        pDhContext->m_cPendingCapacity = cNewCapacity;
+    }
+
+    DhPendingHandle *pEntry = &pDhContext->m_pPending[pDhContext->m_cPending++];
+    pEntry->m_pPrimary = pPrimaryRef;
+    pEntry->m_pSecondary = pSecondaryRef;
+}
+
 void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
 {
     LIMITED_METHOD_CONTRACT;
@@ -262,6 +293,11 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+
+        if (pDhContext->m_fRecordPending)
+        {
+            DhAddPendingHandle(pDhContext, pPrimaryRef, pSecondaryRef);
+        }
     }
 }
 
@@ -699,6 +735,7 @@ bool Ref_Initialize()
     g_pDependentHandleContexts = new (nothrow) DhContext[n_slots];
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
+    memset(g_pDependentHandleContexts, 0, n_slots * sizeof(DhContext));
 
     return true;
 
@@ -718,6 +755,10 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        for (int i = 0; i < getNumberOfSlots(); i++)
+        {
+            delete [] g_pDependentHandleContexts[i].m_pPending;
+        }
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -1282,6 +1323,8 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
     return &g_pDependentHandleContexts[getSlotNumber(sc)];
 }
 
+static bool DhScanPendingHandlesForPromotion(DhContext *pDhContext);
+
 // Scan the dependent handle table promoting any secondary object whose associated primary object is promoted.
 //
 // Multiple scans may be required since (a) secondary promotions made during one scan could cause the primary
@@ -1292,6 +1335,15 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
 bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
 {
     LOG((LF_GC, LL_INFO10000, "Checking liveness of referents of dependent handles in generation %u\n", pDhContext->m_iCondemned));
+
+    // The handle table can change under a concurrent scan so we can only use what an earlier scan recorded
+    // when this one isn't concurrent.
+    if (pDhContext->m_fPendingValid && !pDhContext->m_pScanContext->concurrent)
+    {
+        return DhScanPendingHandlesForPromotion(pDhContext);
+    }
+    pDhContext->m_fPendingValid = false;
+
     uint32_t type = HNDTYPE_DEPENDENT;
     uint32_t flags = (pDhContext->m_pScanContext->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
     flags |= HNDGCF_EXTRAINFO;
@@ -1316,6 +1368,10 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         pDhContext->m_fUnpromotedPrimaries = false;
         pDhContext->m_fPromoted = false;
 
+        // Every iteration walks the whole table so only the last one's list is current.
+        pDhContext->m_fRecordPending = !pDhContext->m_pScanContext->concurrent;
+        pDhContext->m_cPending = 0;
+
         HandleTableMap *walk = &g_HandleTableMap;
         while (walk)
         {
@@ -1353,6 +1409,66 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
 
     } while (pDhContext->m_fUnpromotedPrimaries && pDhContext->m_fPromoted);
 
+    // If we recorded every unpromoted primary the re-scans only need to look at those.
+    pDhContext->m_fPendingValid = pDhContext->m_fRecordPending;
+    pDhContext->m_fRecordPending = false;
+
+    return fAnyPromotions;
+}
+
+// Same as above but only looks at the handles the last scan found with an unpromoted primary. A handle is
+// dropped from the list once its primary is promoted (and its secondary with it) so each iteration only
+// looks at the handles that may still be promoted.
+static bool DhScanPendingHandlesForPromotion(DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ScanContext *sc = pDhContext->m_pScanContext;
+    promote_func *callback = pDhContext->m_pfnPromoteFunction;
+    bool fAnyPromotions = false;
+
+    do
+    {
+        pDhContext->m_fUnpromotedPrimaries = false;
+        pDhContext->m_fPromoted = false;
+
+        DhPendingHandle *pPending = pDhContext->m_pPending;
+        size_t cRemaining = 0;
+
+        for (size_t i = 0; i < pDhContext->m_cPending; i++)
+        {
+            Object **pPrimaryRef = pPending[i].m_pPrimary;
+            Object **pSecondaryRef = pPending[i].m_pSecondary;
+
+            if (*pPrimaryRef == NULL)
+            {
+                continue;
+            }
+
+            if (g_theGCHeap->IsPromoted(*pPrimaryRef))
+            {
+                if (!g_theGCHeap->IsPromoted(*pSecondaryRef))
+                {
+                    LOG((LF_GC, LL_INFO10000, "\tPromoting secondary " LOG_OBJECT_CLASS(*pSecondaryRef)));
+                    callback(pSecondaryRef, sc, 0);
+                    pDhContext->m_fPromoted = true;
+                }
+            }
+            else
+            {
+                pPending[cRemaining++] = pPending[i];
+                pDhContext->m_fUnpromotedPrimaries = true;
+            }
+        }
+
+        LOG((LF_GC, LL_INFO10000, "Re-scanned %zu pending dependent handles, %zu left\n", pDhContext->m_cPending, cRemaining));
+        pDhContext->m_cPending = cRemaining;
+
+        if (pDhContext->m_fPromoted)
+            fAnyPromotions = true;
+
+    } while (pDhContext->m_fUnpromotedPrimaries && pDhContext->m_fPromoted);
+
     return fAnyPromotions;
 }
 
@@ -0,0 +1,319 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBenchmark.cpp
+//
+
+//
+//  This uses the same GC environment as GCSample to run the GC without the rest of CoreCLR on a synthetic
+//  heap, so changes to the GC can be measured without a full runtime and without the noise of a real app.
+//
+//  The heap is made of binary trees rooted in strong handles, the shape of it is configurable -
+//
+//  -trees N        number of trees
+//  -depth N        depth of each tree, so each one has 2^depth - 1 nodes
+//  -pin P          percentage of nodes that also get a pinned handle
+//  -crossgen P     percentage of old nodes that get a pointer to a young object before each ephemeral GC
+//  -gen0 N         number of young objects allocated before each ephemeral GC
+//  -iterations N   number of times each kind of GC is measured
+//
+//  After the trees are built and promoted to gen2, it reports the average and max pause of gen0, gen1,
+//  gen2 and compacting gen2 GCs. The GC's own per phase times (mark/plan/relocate/compact/sweep) are in
+//  the GCGlobalHeapHistory event and in the GC's dprintf logging, which the stub EE doesn't consume,
+//  so this measures them in isolation by choosing the kind of GC and the shape of the heap instead.
+//
+//  GC settings are read from DOTNET_ environment variables in hex as in the runtime, e.g. setting
+//  DOTNET_GCMarkPrefetchDistance=40 runs it with a mark prefetch distance of 64.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+#include "GCSampleHelpers.h"
+
+class Node : Object {
+public:
+    Object * m_pLeft;
+    Object * m_pRight;
+    size_t m_payload;
+};
+
+static struct Node_MethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+}
+Node_MethodTable;
+
+static MethodTable * InitNodeMethodTable()
+{
+    uint32_t baseSize = sizeof(Node) + sizeof(ObjHeader);
+    Node_MethodTable.m_MT.m_baseSize = max(baseSize, (uint32_t)MIN_OBJECT_SIZE);
+    Node_MethodTable.m_MT.m_componentSize = 0;
+    Node_MethodTable.m_MT.m_flags = MTFlag_ContainsGCPointers;
+
+    // m_pLeft and m_pRight are contiguous so one series covers both
+    Node_MethodTable.m_numSeries = 1;
+    Node_MethodTable.m_series[0].SetSeriesOffset(offsetof(Node, m_pLeft));
+    Node_MethodTable.m_series[0].SetSeriesCount(2);
+    Node_MethodTable.m_series[0].seriessize -= Node_MethodTable.m_MT.m_baseSize;
+
+    return &Node_MethodTable.m_MT;
+}
+
+struct BenchmarkConfig
+{
+    int trees = 16;
+    int depth = 16;
+    int pinPercent = 1;
+    int crossGenPercent = 5;
+    int gen0Objects = 100000;
+    int iterations = 10;
+};
+
+static bool ParseArgs(int argc, char* argv[], BenchmarkConfig* config)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (i + 1 >= argc)
+            return false;
+
+        int value = atoi(argv[i + 1]);
+        if (value < 0)
+            return false;
+
+        if (strcmp(argv[i], "-trees") == 0)
+            config->trees = value;
+        else if (strcmp(argv[i], "-depth") == 0)
+            config->depth = value;
+        else if (strcmp(argv[i], "-pin") == 0)
+            config->pinPercent = value;
+        else if (strcmp(argv[i], "-crossgen") == 0)
+            config->crossGenPercent = value;
+        else if (strcmp(argv[i], "-gen0") == 0)
+            config->gen0Objects = value;
+        else if (strcmp(argv[i], "-iterations") == 0)
+            config->iterations = value;
+        else
+            return false;
+
+        i++;
+    }
+
+    return (config->depth > 0) && (config->depth < 32) && (config->iterations > 0);
+}
+
+// A small LCG is enough here, we want the same heap for the same arguments.
+static uint32_t s_randomState = 12345;
+static uint32_t NextRandom()
+{
+    s_randomState = s_randomState * 1103515245 + 12345;
+    return (s_randomState >> 16) & 0x7fff;
+}
+
+static bool ShouldPick(int percent)
+{
+    return (int)(NextRandom() % 100) < percent;
+}
+
+static HHANDLETABLE GetHandleTable()
+{
+    return g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+}
+
+// Builds a tree of the given depth under the object in the handle and returns false on OOM. The handle
+// is used to get to the parent since any allocation can move it.
+static bool BuildTree(MethodTable * pMT, OBJECTHANDLE hParent, int depth, int pinPercent)
+{
+    if (depth == 0)
+        return true;
+
+    for (int child = 0; child < 2; child++)
+    {
+        Object * pNode = AllocateObject(pMT);
+        if (pNode == NULL)
+            return false;
+
+        Node * pParent = (Node *)HndFetchHandle(hParent);
+        WriteBarrier((child == 0) ? &pParent->m_pLeft : &pParent->m_pRight, pNode);
+
+        if (ShouldPick(pinPercent))
+        {
+            if (HndCreateHandle(GetHandleTable(), HNDTYPE_PINNED, pNode) == NULL)
+                return false;
+        }
+
+        if (depth > 1)
+        {
+            OBJECTHANDLE hChild = HndCreateHandle(GetHandleTable(), HNDTYPE_DEFAULT, pNode);
+            if (hChild == NULL)
+                return false;
+
+            bool succeeded = BuildTree(pMT, hChild, depth - 1, pinPercent);
+            HndDestroyHandle(GetHandleTable(), HNDTYPE_DEFAULT, hChild);
+            if (!succeeded)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Makes crossGenPercent of the leaves of the tree in the handle point to a young object so ephemeral
+// GCs have cards to mark through. The sample EE reports no stack roots and any allocation can trigger
+// a GC that moves the tree, so each leaf is looked up again from the handle after the allocation.
+static bool AddCrossGenPointers(MethodTable * pMT, OBJECTHANDLE hRoot, int depth, int crossGenPercent)
+{
+    uint32_t leafCount = (uint32_t)1 << (depth - 1);
+    for (uint32_t leaf = 0; leaf < leafCount; leaf++)
+    {
+        if (!ShouldPick(crossGenPercent))
+            continue;
+
+        Object * pYoung = AllocateObject(pMT);
+        if (pYoung == NULL)
+            return false;
+
+        // The bits of the leaf index, highest first, choose the path from the root.
+        Node * pNode = (Node *)HndFetchHandle(hRoot);
+        for (int level = depth - 2; level >= 0; level--)
+        {
+            pNode = (Node *)(((leaf >> level) & 1) ? pNode->m_pRight : pNode->m_pLeft);
+        }
+
+        WriteBarrier(&pNode->m_pLeft, pYoung);
+    }
+
+    return true;
+}
+
+struct PauseStats
+{
+    const char * name;
+    int64_t total = 0;
+    int64_t max = 0;
+    int count = 0;
+
+    void Add(int64_t ticks)
+    {
+        total += ticks;
+        max = (ticks > max) ? ticks : max;
+        count++;
+    }
+
+    void Print(int64_t frequency)
+    {
+        double avg_ms = (count == 0) ? 0.0 : ((double)total * 1000.0 / (double)frequency / count);
+        double max_ms = (double)max * 1000.0 / (double)frequency;
+        printf("%-16s %6d GCs, avg %10.3f ms, max %10.3f ms\n", name, count, avg_ms, max_ms);
+    }
+};
+
+static void TimeGC(IGCHeap * pGCHeap, int generation, int mode, PauseStats * stats)
+{
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+    pGCHeap->GarbageCollect(generation, false, mode);
+    stats->Add(GCToOSInterface::QueryPerformanceCounter() - start);
+}
+
+int __cdecl main(int argc, char* argv[])
+{
+    BenchmarkConfig config;
+    if (!ParseArgs(argc, argv, &config))
+    {
+        printf("usage: gcbenchmark [-trees N] [-depth N] [-pin P] [-crossgen P] [-gen0 N] [-iterations N]\n");
+        return -1;
+    }
+
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    ThreadStore::AttachCurrentThread();
+
+    MethodTable * pNodeMT = InitNodeMethodTable();
+
+    //
+    // Build the heap and get it all into gen2
+    //
+    OBJECTHANDLE* roots = new OBJECTHANDLE[config.trees];
+    for (int i = 0; i < config.trees; i++)
+    {
+        Object * pRoot = AllocateObject(pNodeMT);
+        if (pRoot == NULL)
+            return -1;
+
+        roots[i] = HndCreateHandle(GetHandleTable(), HNDTYPE_DEFAULT, pRoot);
+        if ((roots[i] == NULL) || !BuildTree(pNodeMT, roots[i], config.depth - 1, config.pinPercent))
+            return -1;
+    }
+
+    pGCHeap->GarbageCollect(2, false, collection_blocking);
+    pGCHeap->GarbageCollect(2, false, collection_blocking);
+
+    printf("trees: %d, depth: %d, pin: %d%%, crossgen: %d%%, gen0 objects: %d, iterations: %d\n",
+        config.trees, config.depth, config.pinPercent, config.crossGenPercent, config.gen0Objects, config.iterations);
+    printf("heap size after setup: %zd bytes\n", pGCHeap->GetTotalBytesInUse());
+
+    PauseStats gen0Stats = { "gen0" };
+    PauseStats gen1Stats = { "gen1" };
+    PauseStats gen2Stats = { "gen2" };
+    PauseStats gen2CompactStats = { "gen2 compacting" };
+
+    for (int iteration = 0; iteration < config.iterations; iteration++)
+    {
+        for (int generation = 0; generation <= 1; generation++)
+        {
+            for (int i = 0; i < config.trees; i++)
+            {
+                if (!AddCrossGenPointers(pNodeMT, roots[i], config.depth, config.crossGenPercent))
+                    return -1;
+            }
+
+            for (int i = 0; i < config.gen0Objects; i++)
+            {
+                if (AllocateObject(pNodeMT) == NULL)
+                    return -1;
+            }
+
+            TimeGC(pGCHeap, generation, collection_blocking, (generation == 0) ? &gen0Stats : &gen1Stats);
+        }
+
+        TimeGC(pGCHeap, 2, collection_blocking, &gen2Stats);
+        TimeGC(pGCHeap, 2, (collection_blocking | collection_compacting), &gen2CompactStats);
+    }
+
+    int64_t frequency = GCToOSInterface::QueryPerformanceFrequency();
+    gen0Stats.Print(frequency);
+    gen1Stats.Print(frequency);
+    gen2Stats.Print(frequency);
+    gen2CompactStats.Print(frequency);
+
+    return 0;
+}
@@ -10,7 +10,7 @@
 //
 //  * How to initialize GC without the rest of CoreCLR
 //  * How to create a type layout information in format that the GC expects
-//  * How to implement fast object allocator and write barrier
+//  * How to implement fast object allocator and write barrier (see GCSampleHelpers.h)
 //  * How to allocate objects and work with GC handles
 //
 //  An important part of the sample is the GC environment (gcenv.*) that provides methods for GC to interact
@@ -47,72 +47,7 @@
 
 #include "gcdesc.h"
 
-#ifdef TARGET_X86
-#define LOCALGC_CALLCONV __cdecl
-#else
-#define LOCALGC_CALLCONV
-#endif
-
-//
-// The fast paths for object allocation and write barriers is performance critical. They are often
-// hand written in assembly code, etc.
-//
-Object * AllocateObject(MethodTable * pMT)
-{
-    alloc_context * acontext = GetThread()->GetAllocContext();
-    Object * pObject;
-
-    size_t size = pMT->GetBaseSize();
-
-    uint8_t* result = acontext->alloc_ptr;
-    uint8_t* advance = result + size;
-    if (advance <= acontext->alloc_limit)
-    {
-        acontext->alloc_ptr = advance;
-        pObject = (Object *)result;
-    }
-    else
-    {
-        pObject = g_theGCHeap->Alloc(acontext, size, 0);
-        if (pObject == NULL)
-            return NULL;
-    }
-
-    pObject->RawSetMethodTable(pMT);
-
-    return pObject;
-}
-
-#if defined(HOST_64BIT)
-// Card byte shift is different on 64bit.
-#define card_byte_shift     11
-#else
-#define card_byte_shift     10
-#endif
-
-#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
-
-inline void ErectWriteBarrier(Object ** dst, Object * ref)
-{
-    // if the dst is outside of the heap (unboxed value classes) then we
-    //      simply exit
-    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
-        return;
-
-    // volatile is used here to prevent fetch of g_card_table from being reordered
-    // with g_lowest/highest_address check above. See comments in StompWriteBarrier
-    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
-    if(*pCardByte != 0xFF)
-        *pCardByte = 0xFF;
-}
-
-void WriteBarrier(Object ** dst, Object * ref)
-{
-    *dst = ref;
-    ErectWriteBarrier(dst, ref);
-}
-
-extern "C" HRESULT LOCALGC_CALLCONV GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+#include "GCSampleHelpers.h"
 
 int __cdecl main(int argc, char* argv[])
 {
@@ -278,14 +278,50 @@ bool GCToEEInterface::EagerFinalized(Object* obj)
     return false;
 }
 
+// GC settings are read from DOTNET_<privateKey> environment variables, in hex like the runtime
+// reads them, so the sample and gcbenchmark can be run with different GC configurations.
+static bool GetConfigValueFromEnvironment(const char* privateKey, int64_t* value)
+{
+    char name[128];
+    char str[32];
+    if ((privateKey == NULL) ||
+        (_snprintf_s(name, sizeof(name), _TRUNCATE, "DOTNET_%s", privateKey) < 0))
+    {
+        return false;
+    }
+
+    DWORD len = GetEnvironmentVariableA(name, str, sizeof(str));
+    if ((len == 0) || (len >= sizeof(str)))
+    {
+        return false;
+    }
+
+    char* end;
+    uint64_t result = _strtoui64(str, &end, 16);
+    if ((end == str) || (*end != '\0'))
+    {
+        return false;
+    }
+
+    *value = (int64_t)result;
+    return true;
+}
+
 bool GCToEEInterface::GetBooleanConfigValue(const char* privateKey, const char* publicKey, bool* value)
 {
-    return false;
+    int64_t result;
+    if (!GetConfigValueFromEnvironment(privateKey, &result))
+    {
+        return false;
+    }
+
+    *value = (result != 0);
+    return true;
 }
 
 bool GCToEEInterface::GetIntConfigValue(const char* privateKey, const char* publicKey, int64_t* value)
 {
-    return false;
+    return GetConfigValueFromEnvironment(privateKey, value);
 }
 
 bool GCToEEInterface::GetStringConfigValue(const char* privateKey, const char* publicKey, const char** value)
@@ -45,6 +45,7 @@ Abstract:
 #define PROC_STATM_FILENAME "/proc/self/statm"
 #define CGROUP1_MEMORY_LIMIT_FILENAME "/memory.limit_in_bytes"
 #define CGROUP2_MEMORY_LIMIT_FILENAME "/memory.max"
+#define CGROUP2_MEMORY_HIGH_FILENAME "/memory.high"
 #define CGROUP_MEMORY_STAT_FILENAME "/memory.stat"
 #define CGROUP1_MEMORY_USAGE_FILENAME "/memory.usage_in_bytes"
 #define CGROUP2_MEMORY_USAGE_FILENAME "/memory.current"
@@ -458,14 +459,18 @@ private:
         if (s_memory_cgroup_path == nullptr)
             return false;
 
-        // Process the whole CGroup hierarchy to find a level with the most limiting limit
+        // Process the whole CGroup hierarchy to find a level with the most limiting limit.
+        // Besides memory.max we also honor memory.high: above it the kernel throttles the
+        // cgroup and reclaims aggressively, so the GC should keep the heap below it as well.
+        static const char* const limitFileNames[] = { CGROUP2_MEMORY_LIMIT_FILENAME, CGROUP2_MEMORY_HIGH_FILENAME };
         size_t memory_cgroup_hierarchy_mount_length = strlen(s_memory_cgroup_hierarchy_mount);
         uint64_t min_limit = std::numeric_limits<uint64_t>::max();
         uint64_t limit;
         bool found_any_limit = false;
 
+        // Size the buffer for the longest file name, the parent directory paths are all shorter
         char *mem_limit_filename = nullptr;
-        if (asprintf(&mem_limit_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_LIMIT_FILENAME) < 0)
+        if (asprintf(&mem_limit_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_HIGH_FILENAME) < 0)
             return false;
 
         size_t cgroupPathLength = strlen(s_memory_cgroup_path);
@@ -474,16 +479,22 @@ private:
         // mount directory. The mount directory doesn't contain the memory.max.
         do
         {
-            if (ReadMemoryValueFromFile(mem_limit_filename, &limit))
+            for (const char* limitFileName : limitFileNames)
             {
-                found_any_limit = true;
-                if (limit < min_limit)
+                strcpy(mem_limit_filename + cgroupPathLength, limitFileName);
+
+                // The files contain "max" when no limit is set, which fails to parse
+                if (ReadMemoryValueFromFile(mem_limit_filename, &limit))
                 {
-                    min_limit = limit;
+                    found_any_limit = true;
+                    if (limit < min_limit)
+                    {
+                        min_limit = limit;
+                    }
                 }
             }
 
-            // Get the parent cgroup memory limit file path
+            // Get the parent cgroup directory
             char *parent_directory_end = mem_limit_filename + cgroupPathLength - 1;
             while (*parent_directory_end != '/')
             {
@@ -491,8 +502,6 @@ private:
             }
 
             cgroupPathLength = parent_directory_end - mem_limit_filename;
-
-            strcpy(parent_directory_end, CGROUP2_MEMORY_LIMIT_FILENAME);
         }
         while (cgroupPathLength != memory_cgroup_hierarchy_mount_length);
 
@@ -763,6 +763,25 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
     return (st == 0);
 }
 
+// Advise the OS whether to back the committed virtual memory range with huge pages when it can do
+// so transparently, without reserving them up front.
+// Parameters:
+//  address - starting virtual address, must be page aligned
+//  size    - size of the virtual memory range
+//  enable  - true to ask for huge pages, false to ask for normal pages again
+// Return:
+//  true if the advice was accepted, false if it is not supported or has failed
+bool GCToOSInterface::VirtualAdviseHugePages(void* address, size_t size, bool enable)
+{
+#if defined(MADV_HUGEPAGE) && defined(MADV_NOHUGEPAGE)
+    // MADV_NOHUGEPAGE keeps khugepaged from collapsing the range again, it does not split huge pages
+    // that are already backing it.
+    return (madvise(address, size, (enable ? MADV_HUGEPAGE : MADV_NOHUGEPAGE)) == 0);
+#else
+    return false;
+#endif //MADV_HUGEPAGE && MADV_NOHUGEPAGE
+}
+
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
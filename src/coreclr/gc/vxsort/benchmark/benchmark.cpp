@@ -0,0 +1,108 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+// Compares the vectorized mark list sort against the scalar fallback on
+// inputs shaped like a GC mark list: 8-byte aligned object addresses within a
+// bounded range, which is what allows vxsort to pack to 32-bit elements.
+//
+// usage: ./vxsort-benchmark [element count] [address range in MB]
+
+#include "common.h"
+#include "../do_vxsort.h"
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef TARGET_ARM64
+static bool s_avx2;
+static bool s_avx512f;
+
+bool IsSupportedInstructionSet (InstructionSet instructionSet)
+{
+    return (instructionSet == InstructionSet::AVX2) ? s_avx2 : s_avx512f;
+}
+
+void InitSupportedInstructionSet (int32_t configSetting)
+{
+    s_avx2 = ((configSetting & 1) != 0) && __builtin_cpu_supports ("avx2");
+    s_avx512f = s_avx2 && ((configSetting & 2) != 0) && __builtin_cpu_supports ("avx512f");
+}
+#endif // !TARGET_ARM64
+
+static void vectorized_sort (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high)
+{
+#ifdef TARGET_ARM64
+    do_vxsort_neon (low, high, range_low, range_high);
+#else
+    if (!IsSupportedInstructionSet (InstructionSet::AVX2))
+    {
+        fprintf (stderr, "AVX2 is not supported on this machine\n");
+        exit (1);
+    }
+
+    if (IsSupportedInstructionSet (InstructionSet::AVX512F))
+        do_vxsort_avx512 (low, high, range_low, range_high);
+    else
+        do_vxsort_avx2 (low, high, range_low, range_high);
+#endif
+}
+
+static double measure (const std::vector<uint8_t*>& input, std::vector<uint8_t*>& work, int iterations, bool vectorized)
+{
+    uint8_t* range_low = *std::min_element (input.begin (), input.end ());
+    uint8_t* range_high = *std::max_element (input.begin (), input.end ());
+    double best = 1e30;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        work = input;
+        auto start = std::chrono::steady_clock::now ();
+        if (vectorized)
+            vectorized_sort (work.data (), &work[work.size () - 1], range_low, range_high);
+        else
+            std::sort (work.begin (), work.end ());
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now () - start;
+        best = std::min (best, elapsed.count ());
+    }
+
+    for (size_t i = 1; i < work.size (); i++)
+    {
+        if (work[i - 1] > work[i])
+        {
+            fprintf (stderr, "output is not sorted at index %zu\n", i);
+            exit (1);
+        }
+    }
+
+    return best;
+}
+
+int main (int argc, char** argv)
+{
+    InitSupportedInstructionSet (-1);
+
+    const int iterations = 20;
+    size_t max_count = (argc > 1) ? strtoull (argv[1], nullptr, 10) : (1024 * 1024);
+    size_t range_mb = (argc > 2) ? strtoull (argv[2], nullptr, 10) : 1024;
+    uint64_t base = 0x7f0000000000ull;
+
+    std::mt19937_64 rng (0x5eed);
+    printf ("%12s %14s %14s %10s\n", "count", "scalar (us)", "vector (us)", "speedup");
+
+    for (size_t count = 1024; count <= max_count; count *= 4)
+    {
+        std::vector<uint8_t*> input (count);
+        for (size_t i = 0; i < count; i++)
+            input[i] = (uint8_t*)((base + (rng () % (range_mb * 1024 * 1024))) & ~(uint64_t)7);
+
+        std::vector<uint8_t*> work;
+        double scalar = measure (input, work, iterations, false);
+        double vector = measure (input, work, iterations, true);
+        printf ("%12zu %14.1f %14.1f %9.2fx\n", count, scalar, vector, scalar / vector);
+    }
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+// Minimal stand-in for the GC environment's common.h so the vxsort sources
+// can be built outside of the runtime for benchmarking.
+
+#ifndef VXSORT_BENCHMARK_COMMON_H
+#define VXSORT_BENCHMARK_COMMON_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+#include <algorithm>
+#include <limits>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define TARGET_ARM64
+#else
+#define TARGET_AMD64
+#endif
+
+#endif // VXSORT_BENCHMARK_COMMON_H
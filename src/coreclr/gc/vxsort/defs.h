@@ -13,6 +13,7 @@
 #endif
 #ifdef _M_ARM64
 #define ARCH_ARM
+#define ARCH_ARM64
 #endif
 #else
 #ifdef __i386__
@@ -24,6 +25,9 @@
 #ifdef __arm__
 #define ARCH_ARM
 #endif
+#ifdef __aarch64__
+#define ARCH_ARM64
+#endif
 #endif
 
 #ifdef _MSC_VER
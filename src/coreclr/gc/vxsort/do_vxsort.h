@@ -4,13 +4,21 @@
 // Enum for the IsSupportedInstructionSet method
 enum class InstructionSet
 {
+#if defined(TARGET_ARM64)
+    NEON = 0,
+#else
     AVX2 = 0,
     AVX512F = 1,
+#endif
 };
 
 void InitSupportedInstructionSet (int32_t configSetting);
 bool IsSupportedInstructionSet (InstructionSet instructionSet);
 
+#if defined(TARGET_ARM64)
+void do_vxsort_neon (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high);
+#else
 void do_vxsort_avx2 (uint8_t** low, uint8_t** high, uint8_t *range_low, uint8_t *range_high);
 
 void do_vxsort_avx512 (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high);
+#endif
@@ -9,10 +9,21 @@
 enum class SupportedISA
 {
     None = 0,
+#if defined(TARGET_ARM64)
+    NEON = 1 << (int)InstructionSet::NEON
+#else
     AVX2 = 1 << (int)InstructionSet::AVX2,
     AVX512F = 1 << (int)InstructionSet::AVX512F
+#endif
 };
 
+#if defined(TARGET_ARM64)
+SupportedISA DetermineSupportedISA()
+{
+    // AdvSimd is part of the arm64 baseline
+    return SupportedISA::NEON;
+}
+#else
 SupportedISA DetermineSupportedISA()
 {
     int cpuFeatures = minipal_getcpufeatures();
@@ -28,6 +39,7 @@ SupportedISA DetermineSupportedISA()
         return SupportedISA::None;
     }
 }
+#endif
 
 static bool s_initialized;
 static SupportedISA s_supportedISA;
@@ -35,16 +47,22 @@ static SupportedISA s_supportedISA;
 bool IsSupportedInstructionSet (InstructionSet instructionSet)
 {
     assert(s_initialized);
+#if defined(TARGET_ARM64)
+    assert(instructionSet == InstructionSet::NEON);
+#else
     assert(instructionSet == InstructionSet::AVX2 || instructionSet == InstructionSet::AVX512F);
+#endif
     return ((int)s_supportedISA & (1 << (int)instructionSet)) != 0;
 }
 
 void InitSupportedInstructionSet (int32_t configSetting)
 {
     s_supportedISA = (SupportedISA)((int)DetermineSupportedISA() & configSetting);
+#if !defined(TARGET_ARM64)
     // we are assuming that AVX2 can be used if AVX512F can,
     // so if AVX2 is disabled, we need to disable AVX512F as well
     if (!((int)s_supportedISA & (int)SupportedISA::AVX2))
         s_supportedISA = SupportedISA::None;
+#endif
     s_initialized = true;
 }
@@ -0,0 +1,121 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "../machine_traits.neon.h"
+#include "bitonic_sort.h"
+
+// Unlike the AVX2/AVX512 small sorts, this is not generated: with 128-bit vectors
+// there are only 2 (int64_t) or 4 (int32_t) elements per register, so a single
+// bitonic network over a padded, power-of-two sized scratch buffer is used for every
+// length instead of one unrolled routine per vector count.
+//
+// Compare-exchange steps whose distance is at least one vector are done between
+// whole vectors; the steps within a vector compare each lane with its partner lane
+// (obtained with a lane swap) and pick min or max per lane.
+
+namespace vxsort {
+namespace smallsort {
+
+alignas(16) static const uint32_t lane_index_32[4] = { 0, 1, 2, 3 };
+alignas(16) static const uint64_t lane_index_64[2] = { 0, 1 };
+
+template <typename T>
+struct bitonic_neon_lanes;
+
+template <>
+struct bitonic_neon_lanes<int32_t> {
+    typedef int32x4_t TV;
+
+    // swap each lane with the lane at distance j (j < 4)
+    static INLINE TV partner(TV v, size_t j) {
+        return (j == 1) ? vrev64q_s32(v) : vextq_s32(v, v, 2);
+    }
+
+    // lanes of the vector starting at element i that keep the minimum of the pair
+    static INLINE TV select(size_t i, size_t j, size_t k, TV mn, TV mx) {
+        uint32x4_t idx = vaddq_u32(vdupq_n_u32((uint32_t)i), vld1q_u32(lane_index_32));
+        uint32x4_t lower = vceqq_u32(vandq_u32(idx, vdupq_n_u32((uint32_t)j)), vdupq_n_u32(0));
+        uint32x4_t ascending = vceqq_u32(vandq_u32(idx, vdupq_n_u32((uint32_t)k)), vdupq_n_u32(0));
+        return vbslq_s32(vceqq_u32(lower, ascending), mn, mx);
+    }
+};
+
+template <>
+struct bitonic_neon_lanes<int64_t> {
+    typedef int64x2_t TV;
+
+    static INLINE TV partner(TV v, size_t j) {
+        assert(j == 1);
+        return vextq_s64(v, v, 1);
+    }
+
+    static INLINE TV select(size_t i, size_t j, size_t k, TV mn, TV mx) {
+        uint64x2_t idx = vaddq_u64(vdupq_n_u64((uint64_t)i), vld1q_u64(lane_index_64));
+        uint64x2_t lower = vceqq_u64(vandq_u64(idx, vdupq_n_u64((uint64_t)j)), vdupq_n_u64(0));
+        uint64x2_t ascending = vceqq_u64(vandq_u64(idx, vdupq_n_u64((uint64_t)k)), vdupq_n_u64(0));
+        return vbslq_s64(vceqq_u64(lower, ascending), mn, mx);
+    }
+};
+
+template <typename T>
+static void bitonic_sort_neon(T* ptr, size_t length) {
+    using MT = vxsort_machine_traits<T, NEON>;
+    using L = bitonic_neon_lanes<T>;
+    typedef typename MT::TV TV;
+
+    const size_t N = sizeof(TV) / sizeof(T);
+    const size_t MAX_LENGTH = 16 * N;
+    assert(length <= MAX_LENGTH);
+
+    size_t n = N;
+    while (n < length)
+        n *= 2;
+
+    alignas(16) T buffer[MAX_LENGTH];
+    memcpy(buffer, ptr, length * sizeof(T));
+    for (size_t i = length; i < n; i++)
+        buffer[i] = std::numeric_limits<T>::max();
+
+    TV* v = (TV*)buffer;
+
+    for (size_t k = 2; k <= n; k *= 2) {
+        for (size_t j = k / 2; j > 0; j /= 2) {
+            if (j >= N) {
+                const size_t jv = j / N;
+                for (size_t i = 0; i < n; i += N) {
+                    if ((i & j) != 0)
+                        continue;
+                    TV a = MT::load_vec(v + i / N);
+                    TV b = MT::load_vec(v + i / N + jv);
+                    TV mn = MT::min(a, b);
+                    TV mx = MT::max(a, b);
+                    const bool ascending = ((i & k) == 0);
+                    MT::store_vec(v + i / N, ascending ? mn : mx);
+                    MT::store_vec(v + i / N + jv, ascending ? mx : mn);
+                }
+            } else {
+                for (size_t i = 0; i < n; i += N) {
+                    TV a = MT::load_vec(v + i / N);
+                    TV s = L::partner(a, j);
+                    MT::store_vec(v + i / N, L::select(i, j, k, MT::min(a, s), MT::max(a, s)));
+                }
+            }
+        }
+    }
+
+    memcpy(ptr, buffer, length * sizeof(T));
+}
+
+template <>
+void bitonic<int32_t, NEON>::sort(int32_t* ptr, size_t length) {
+    bitonic_sort_neon<int32_t>(ptr, length);
+}
+
+template <>
+void bitonic<int64_t, NEON>::sort(int64_t* ptr, size_t length) {
+    bitonic_sort_neon<int64_t>(ptr, length);
+}
+
+}  // namespace smallsort
+}  // namespace vxsort
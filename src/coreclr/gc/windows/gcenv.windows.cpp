@@ -794,6 +794,20 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
     return success;
 }
 
+// Advise the OS whether to back the committed virtual memory range with huge pages when it can do
+// so transparently, without reserving them up front.
+// Parameters:
+//  address - starting virtual address, must be page aligned
+//  size    - size of the virtual memory range
+//  enable  - true to ask for huge pages, false to ask for normal pages again
+// Return:
+//  true if the advice was accepted, false if it is not supported or has failed
+bool GCToOSInterface::VirtualAdviseHugePages(void* address, size_t size, bool enable)
+{
+    // Large pages on Windows have to be allocated up front and locked, see VirtualReserveAndCommitLargePages
+    return false;
+}
+
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
@@ -1950,8 +1950,22 @@ void InterpCompiler::EmitStoreVar(int32_t var)
         EmitConv(m_pStackPointer - 1, StackTypeR4, INTOP_CONV_R4_R8);
 
     m_pStackPointer--;
+
+    // If the value was just computed by the last instruction of this bblock, it is consumed
+    // only by this store, so have that instruction write the local directly instead of
+    // emitting a separate mov.
+    InterpInst *pLastIns = m_pCBB->pLastIns;
+    int32_t sVar = m_pStackPointer[0].var;
+    if (interpType != InterpTypeVT && pLastIns != NULL && pLastIns == m_pLastNewIns &&
+        pLastIns->dVar == sVar && InterpOpCanRetargetDVar(pLastIns->opcode) &&
+        g_stackTypeFromInterpType[m_pVars[sVar].interpType] == g_stackTypeFromInterpType[interpType])
+    {
+        pLastIns->SetDVar(var);
+        return;
+    }
+
     AddIns(InterpGetMovForType(interpType, false));
-    m_pLastNewIns->SetSVar(m_pStackPointer[0].var);
+    m_pLastNewIns->SetSVar(sVar);
     m_pLastNewIns->SetDVar(var);
     if (interpType == InterpTypeVT)
         m_pLastNewIns->data[0] = m_pVars[var].size;
@@ -2068,8 +2082,27 @@ void InterpCompiler::EmitBinaryArithmeticOp(int32_t opBase)
     int32_t finalOpcode = opBase + typeOffset;
 
     m_pStackPointer -= 2;
-    AddIns(finalOpcode);
-    m_pLastNewIns->SetSVars2(m_pStackPointer[0].var, m_pStackPointer[1].var);
+
+    InterpInst *pLastIns = m_pCBB->pLastIns;
+    if ((finalOpcode == INTOP_ADD_I4 || finalOpcode == INTOP_SUB_I4) && pLastIns != NULL &&
+        pLastIns == m_pLastNewIns && pLastIns->opcode == INTOP_LDC_I4 &&
+        pLastIns->dVar == m_pStackPointer[1].var)
+    {
+        // The second operand is a constant that was just loaded, fold it into an add.imm
+        int32_t imm = pLastIns->data[0];
+        if (finalOpcode == INTOP_SUB_I4)
+            imm = (int32_t)(0 - (uint32_t)imm);
+        ClearIns(pLastIns);
+
+        AddIns(INTOP_ADD_I4_IMM);
+        m_pLastNewIns->SetSVar(m_pStackPointer[0].var);
+        m_pLastNewIns->data[0] = imm;
+    }
+    else
+    {
+        AddIns(finalOpcode);
+        m_pLastNewIns->SetSVars2(m_pStackPointer[0].var, m_pStackPointer[1].var);
+    }
     PushStackType(typeRes, NULL);
     m_pLastNewIns->SetDVar(m_pStackPointer[-1].var);
 }
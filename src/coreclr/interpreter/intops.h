@@ -83,6 +83,16 @@ static inline bool InterpOpIsCondBranch(int32_t opcode)
     return opcode >= INTOP_BRFALSE_I4 && opcode <= INTOP_BLT_UN_R8;
 }
 
+// Opcodes that write a single non-VT dvar from their sources and nothing else, so the
+// result can be written straight to another var of the same stack type.
+static inline bool InterpOpCanRetargetDVar(int32_t opcode)
+{
+    return (opcode >= INTOP_LDC_I4 && opcode <= INTOP_LDC_R8) ||
+        (opcode >= INTOP_MOV_I4_I1 && opcode <= INTOP_MOV_8) ||
+        (opcode >= INTOP_NEG_I4 && opcode <= INTOP_CONV_OVF_U4_U8) ||
+        (opcode >= INTOP_ADD_I4_IMM && opcode <= INTOP_CLT_UN_R8);
+}
+
 // Helpers for reading data from uint8_t code stream
 inline uint16_t getU2LittleEndian(const uint8_t* ptr)
 {
@@ -48,7 +48,9 @@ NamedIntrinsic GetNamedIntrinsic(COMP_HANDLE compHnd, CORINFO_METHOD_HANDLE comp
     }
     else if (!strcmp(namespaceName, "System.Runtime.Intrinsics"))
     {
-        // Vector128<T> etc
+        // Vector128<T> etc. Reporting these as not accelerated makes vectorized library code take
+        // its scalar paths, which interpret much faster than the software Vector128 fallbacks would.
+        // Native SIMD opcodes would need to be added before this can return true.
         if (HAS_PREFIX(className, "Vector") && !strcmp(methodName, "get_IsHardwareAccelerated"))
             return NI_IsSupported_False;
 
@@ -1177,7 +1177,8 @@ BasicBlock* AsyncTransformation::CreateSuspension(
 
     JITDUMP("  Creating suspension " FMT_BB " for state %u\n", suspendBB->bbNum, stateNum);
 
-    // Allocate continuation
+    // Allocate continuation. This only happens once the callee has actually suspended; until then
+    // live state stays in registers/on the stack, so synchronously completing calls never allocate.
     GenTree* returnedContinuation = m_comp->gtNewLclvNode(m_returnedContinuationVar, TYP_REF);
 
     GenTreeCall* allocContinuation =
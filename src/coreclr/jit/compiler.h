@@ -5757,6 +5757,8 @@ public:
     void fgValueNumberFieldStore(
         GenTree* storeNode, GenTree* baseAddr, FieldSeq* fieldSeq, ssize_t offset, unsigned storeSize, ValueNum value);
 
+    bool fgIsFieldAddrOfByrefLocal(GenTree* addr, GenTree** pBaseAddr, FieldSeq** pFldSeq, ssize_t* pOffset);
+
     static bool fgGetStaticFieldSeqAndAddress(ValueNumStore* vnStore, GenTree* tree, ssize_t* byteOffset, FieldSeq** pFseq);
 
     bool fgValueNumberConstLoad(GenTreeIndir* tree);
@@ -7374,6 +7376,7 @@ public:
 #define OMF_HAS_EXPANDABLE_CAST                0x00080000 // Method contains casts eligible for late expansion
 #define OMF_HAS_STACK_ARRAY                    0x00100000 // Method contains stack allocated arrays
 #define OMF_HAS_BOUNDS_CHECKS                  0x00200000 // Method contains bounds checks
+#define OMF_HAS_STACK_OBJ_CALL_ARG             0x00400000 // Method passes a stack allocated object's address to a callee
 
     // clang-format on
 
@@ -7474,6 +7477,16 @@ public:
         optMethodFlags |= OMF_HAS_STACK_ARRAY;
     }
 
+    bool doesMethodHaveStackObjectCallArg()
+    {
+        return (optMethodFlags & OMF_HAS_STACK_OBJ_CALL_ARG) != 0;
+    }
+
+    void setMethodHasStackObjectCallArg()
+    {
+        optMethodFlags |= OMF_HAS_STACK_OBJ_CALL_ARG;
+    }
+
     void pickGDV(GenTreeCall*           call,
                  IL_OFFSET              ilOffset,
                  bool                   isInterface,
@@ -7638,6 +7651,10 @@ public:
     bool optRemoveUnusedIVs(FlowGraphNaturalLoop* loop, PerLoopInfo* loopLocals);
     bool optIsUpdateOfIVWithoutSideEffects(GenTree* tree, unsigned lclNum);
 
+#ifdef DEBUG
+    bool optIsLoopVectorizationCandidate(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop);
+#endif
+
     // Redundant branch opts
     //
     PhaseStatus   optRedundantBranches();
@@ -17015,17 +17015,32 @@ bool emitter::OptimizeLdrStr(instruction ins,
 {
     assert(ins == INS_ldr || ins == INS_str);
 
-    if (!emitCanPeepholeLastIns() || (emitLastIns->idIns() != ins))
+    if (!emitCanPeepholeLastIns())
     {
         return false;
     }
 
-    // Is the ldr/str even necessary?
-    if (IsRedundantLdStr(ins, reg1, reg2, imm, size, fmt))
+    // Is the ldr/str even necessary? Eliding a GC-typed reload would leave the emitter's GC
+    // tracking without the instruction that makes the register live again, so keep those.
+    if (((ins == INS_str) || !EA_IS_GCREF_OR_BYREF(reg1Attr)) && IsRedundantLdStr(ins, reg1, reg2, imm, size, fmt))
     {
         return true;
     }
 
+    // If we are reloading a non-GC value that was just stored, forward it from the stored register.
+    if ((ins == INS_ldr) && (emitLastIns->idIns() == INS_str) && !EA_IS_GCREF_OR_BYREF(reg1Attr) &&
+        (emitLastIns->idGCref() == GCT_NONE) &&
+        IsOptimizableLdrToMov(ins, reg1, encodingZRtoSP(reg2), imm, size, fmt))
+    {
+        emitIns_Mov(INS_mov, reg1Attr, reg1, emitLastIns->idReg1(), true);
+        return true;
+    }
+
+    if (emitLastIns->idIns() != ins)
+    {
+        return false;
+    }
+
     // Register 2 needs conversion to unencoded value for following optimisation checks.
     reg2 = encodingZRtoSP(reg2);
 
@@ -17291,12 +17306,16 @@ emitter::RegisterOrder emitter::IsOptimizableLdrStrWithPair(
 }
 
 //-----------------------------------------------------------------------------------
-// IsOptimizableLdrToMov: Check if it is possible to optimize a second "ldr"
-//                        instruction into a cheaper "mov" instruction.
+// IsOptimizableLdrToMov: Check if it is possible to optimize a "ldr" instruction that
+//                        follows a "ldr" or "str" of the same location into a cheaper
+//                        "mov" instruction.
 //
 // Examples:            ldr     w1, [x20, #0x10]
 //                      ldr     w2, [x20, #0x10]    =>  mov     w2, w1
 //
+//                      str     x1, [fp, #0x18]
+//                      ldr     x2, [fp, #0x18]     =>  mov     x2, x1
+//
 // Arguments:
 //     ins  - The instruction code
 //     reg1 - Register 1 number
@@ -17317,9 +17336,11 @@ bool emitter::IsOptimizableLdrToMov(
         return false;
     }
 
-    if (ins != emitLastIns->idIns())
+    const instruction prevIns = emitLastIns->idIns();
+
+    if ((prevIns != INS_ldr) && (prevIns != INS_str))
     {
-        // Not successive "ldr" instructions.
+        // Not preceded by a "ldr" or "str" instruction.
         return false;
     }
 
@@ -17354,12 +17375,19 @@ bool emitter::IsOptimizableLdrToMov(
         return false;
     }
 
-    if (prevReg1 == prevReg2)
+    if ((prevIns == INS_ldr) && (prevReg1 == prevReg2))
     {
         // Then the previous load overwrote the register that we are indexing against.
         return false;
     }
 
+    if ((prevIns == INS_str) && (prevReg1 == reg1))
+    {
+        // Reloading into the stored register is handled by IsRedundantLdStr; a 4-byte
+        // reload still needs to zero the upper bits, which a skippable "mov" would not do.
+        return false;
+    }
+
     if (prevSize != size)
     {
         // Operand sizes differ.
@@ -3222,6 +3222,19 @@ PhaseStatus Compiler::fgDetermineFirstColdBlock()
 
     bool forceSplit = false;
 
+    // With real profile data we also treat blocks that are almost never reached as cold,
+    // not just the ones whose weight ended up being zero.
+    weight_t  coldWeight = BB_ZERO_WEIGHT;
+    int const coldRatio  = JitConfig.JitSplitColdCallRatio();
+    if (fgIsUsingProfileWeights() && (coldRatio > 0))
+    {
+        coldWeight = BB_UNITY_WEIGHT / coldRatio;
+    }
+
+    auto isColdBlock = [this, coldWeight](BasicBlock* block) {
+        return block->isRunRarely() || (block->getBBWeight(this) < coldWeight);
+    };
+
 #ifdef DEBUG
     // If stress-splitting, split right after the first block
     forceSplit = JitConfig.JitStressProcedureSplitting();
@@ -3252,7 +3265,7 @@ PhaseStatus Compiler::fgDetermineFirstColdBlock()
                 // We have a candidate for first cold block
 
                 // Is this a hot block?
-                if (!block->isRunRarely())
+                if (!isColdBlock(block))
                 {
                     // We have to restart the search for the first cold block
                     firstColdBlock       = nullptr;
@@ -3291,7 +3304,7 @@ PhaseStatus Compiler::fgDetermineFirstColdBlock()
                 }
 
                 // Is this a cold block?
-                if (block->isRunRarely())
+                if (isColdBlock(block))
                 {
                     //
                     // If the last block that was hot was a BBJ_COND
@@ -56,6 +56,7 @@ private:
     void IfConvertFindFlow();
     bool IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperation);
     void IfConvertJoinStmts(BasicBlock* fromBlock);
+    bool IfConvertIsUnpredictable();
 
     GenTree* TryTransformSelectOperOrLocal(GenTree* oper, GenTree* lcl);
     GenTree* TryTransformSelectOperOrZero(GenTree* oper, GenTree* lcl);
@@ -106,6 +107,33 @@ bool OptIfConversionDsc::IfConvertCheckInnerBlockFlow(BasicBlock* block)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// IfConvertIsUnpredictable
+//
+// Check whether profile data indicates the branch at the end of m_startBlock
+// is taken close to half of the time, and so is likely to be mispredicted.
+//
+// Returns:
+//   True if the branch has a trusted profile and a likelihood in the
+//   unpredictable range.
+//
+// Notes:
+//   A 50/50 likelihood does not prove the branch is unpredictable (it may
+//   alternate in a regular pattern), but it is the best signal available here,
+//   and such branches are where a misprediction costs far more than evaluating
+//   both sides.
+//
+bool OptIfConversionDsc::IfConvertIsUnpredictable()
+{
+    if (!m_startBlock->hasProfileWeight() || !m_comp->fgHaveTrustedProfileWeights())
+    {
+        return false;
+    }
+
+    const weight_t likelihood = m_startBlock->GetTrueEdge()->getLikelihood();
+    return (likelihood >= 0.3) && (likelihood <= 0.7);
+}
+
 //-----------------------------------------------------------------------------
 // IfConvertCheckThenFlow
 //
@@ -619,6 +647,10 @@ bool OptIfConversionDsc::optIfConvert()
     }
 #endif
 
+    // Branches that profile data shows are taken about half the time are likely
+    // to be mispredicted, so allow more work to be evaluated unconditionally.
+    const bool isUnpredictable = IfConvertIsUnpredictable();
+
     // Using SELECT nodes means that both Then and Else operations are fully evaluated.
     // Put a limit on the original source and destinations.
     if (!m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_COST, 25))
@@ -647,7 +679,8 @@ bool OptIfConversionDsc::optIfConvert()
         }
 
         // Cost to allow for "x = cond ? a + b : c + d".
-        if (thenCost > 7 || elseCost > 7)
+        const int costLimit = isUnpredictable ? 14 : 7;
+        if (thenCost > costLimit || elseCost > costLimit)
         {
             JITDUMP("Skipping if-conversion that will evaluate RHS unconditionally at costs %d,%d\n", thenCost,
                     elseCost);
@@ -655,11 +688,13 @@ bool OptIfConversionDsc::optIfConvert()
         }
     }
 
-    if (!m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_INNER_LOOPS, 25))
+    if (!isUnpredictable && !m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_INNER_LOOPS, 25))
     {
         // Don't optimise the block if it is inside a loop. Loop-carried
         // dependencies can cause significant stalls if if-converted.
         // Detect via the block weight as that will be high when inside a loop.
+        // An unpredictable branch costs more in mispredictions than the
+        // dependency does, so those are still converted.
 
         if (m_startBlock->getBBWeight(m_comp) > BB_UNITY_WEIGHT * 1.05)
         {
@@ -7071,7 +7071,7 @@ void Compiler::pickGDV(GenTreeCall*           call,
     // Prefer class guess as it is cheaper
     if (numberOfClasses > 0)
     {
-        const int maxNumberOfGuesses = getGDVMaxTypeChecks();
+        int maxNumberOfGuesses = getGDVMaxTypeChecks();
         if (maxNumberOfGuesses == 0)
         {
             // DOTNET_JitGuardedDevirtualizationMaxTypeChecks=0 means we don't want to do any guarded devirtualization
@@ -7079,6 +7079,31 @@ void Compiler::pickGDV(GenTreeCall*           call,
             return;
         }
 
+        // With a single guess a call site with a few roughly equally likely receivers is left to the
+        // stub. If the profile shows those receivers cover most of the calls, guess all of them.
+        //
+        const unsigned polymorphicCoverage = (unsigned)JitConfig.JitGuardedDevirtualizationPolymorphicCoverage();
+        if ((maxNumberOfGuesses == 1) && (JitConfig.JitGuardedDevirtualizationMaxTypeChecks() < 0) &&
+            !call->IsHelperCall() && (polymorphicCoverage > 0))
+        {
+            const unsigned maxPolymorphicGuesses = min(numberOfClasses, (unsigned)MAX_GDV_TYPE_CHECKS);
+            unsigned       polymorphicGuesses    = 0;
+            unsigned       coveredLikelihood     = 0;
+
+            while ((polymorphicGuesses < maxPolymorphicGuesses) && (likelyClasses[polymorphicGuesses].likelihood >= 15))
+            {
+                coveredLikelihood += likelyClasses[polymorphicGuesses].likelihood;
+                polymorphicGuesses++;
+            }
+
+            if ((polymorphicGuesses > 1) && (coveredLikelihood >= polymorphicCoverage))
+            {
+                JITDUMP("%u likely classes cover %u%% of the calls, allowing a guess for each\n", polymorphicGuesses,
+                        coveredLikelihood);
+                maxNumberOfGuesses = (int)polymorphicGuesses;
+            }
+        }
+
         assert((maxNumberOfGuesses > 0) && (maxNumberOfGuesses <= MAX_GDV_TYPE_CHECKS));
 
         unsigned likelihoodThreshold;
@@ -7315,7 +7340,6 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
     {
         pickGDV(call, ilOffset, isInterface, likelyClasses, likelyMethods, &candidatesCount, likelihoods);
         assert((unsigned)candidatesCount <= MAX_GDV_TYPE_CHECKS);
-        assert((unsigned)candidatesCount <= (unsigned)getGDVMaxTypeChecks());
         if (candidatesCount == 0)
         {
             hasPgoData = false;
@@ -2813,6 +2813,122 @@ bool Compiler::optIsUpdateOfIVWithoutSideEffects(GenTree* tree, unsigned lclNum)
     return true;
 }
 
+#ifdef DEBUG
+//------------------------------------------------------------------------
+// optIsLoopVectorizationCandidate:
+//   Check if a loop has the shape a loop vectorizer would handle: a single
+//   block counted loop whose only memory accesses are unit stride loads and
+//   stores of primitives, and whose only loop-carried state is its IVs.
+//
+// Parameters:
+//   scevContext - SCEV context
+//   loop        - The loop
+//
+// Returns:
+//   True if the loop is a candidate.
+//
+// Remarks:
+//   This does not check for aliasing between the accessed ranges; that would
+//   be done by a cloning check in the preheader. The analysis is only used to
+//   measure how many loops are in reach of vectorization.
+//
+bool Compiler::optIsLoopVectorizationCandidate(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop)
+{
+    BasicBlock* header = loop->GetHeader();
+    if ((loop->NumLoopBlocks() != 1) || !header->KindIs(BBJ_COND) || (loop->ExitEdges().size() != 1))
+    {
+        JITDUMP("  Not a single block loop with a single exit; not a vectorization candidate\n");
+        return false;
+    }
+
+    if (scevContext.ComputeExitNotTakenCount(header) == nullptr)
+    {
+        JITDUMP("  Could not compute backedge count; not a vectorization candidate\n");
+        return false;
+    }
+
+    unsigned numStores = 0;
+    for (Statement* stmt : header->NonPhiStatements())
+    {
+        GenTree* root = stmt->GetRootNode();
+        if (root->OperIsLocalStore())
+        {
+            // Stores of loop-carried locals are only allowed for IV updates;
+            // in particular we do not recognize reductions.
+            unsigned lclNum = root->AsLclVarCommon()->GetLclNum();
+            for (Statement* phiStmt : header->Statements())
+            {
+                if (!phiStmt->IsPhiDefnStmt())
+                {
+                    break;
+                }
+
+                if (phiStmt->GetRootNode()->AsLclVarCommon()->GetLclNum() == lclNum)
+                {
+                    Scev* scev = scevContext.Analyze(header, root->AsLclVarCommon()->Data());
+                    if ((scev == nullptr) || !scev->OperIs(ScevOper::AddRec))
+                    {
+                        JITDUMP("  V%02u is carried across iterations but is not an IV\n", lclNum);
+                        return false;
+                    }
+                }
+            }
+        }
+
+        for (GenTree* node : stmt->TreeList())
+        {
+            if (node->IsCall() || node->OperIs(GT_BOUNDS_CHECK))
+            {
+                JITDUMP("  [%06u] is a call or bounds check; not a vectorization candidate\n", dspTreeID(node));
+                return false;
+            }
+
+            if (!node->OperIsIndir())
+            {
+                continue;
+            }
+
+            var_types accessType = node->TypeGet();
+            if (!node->OperIs(GT_IND, GT_STOREIND) || !varTypeIsArithmetic(accessType) ||
+                node->AsIndir()->IsVolatile())
+            {
+                JITDUMP("  [%06u] is not a plain access of a primitive\n", dspTreeID(node));
+                return false;
+            }
+
+            Scev* addr = scevContext.Analyze(header, node->AsIndir()->Addr());
+            if (addr != nullptr)
+            {
+                addr = scevContext.Simplify(addr);
+            }
+
+            int64_t step;
+            if ((addr == nullptr) || !addr->OperIs(ScevOper::AddRec) ||
+                !static_cast<ScevAddRec*>(addr)->Step->GetConstantValue(this, &step) ||
+                (step != (int64_t)genTypeSize(accessType)))
+            {
+                JITDUMP("  Address of [%06u] does not advance by the access size\n", dspTreeID(node));
+                return false;
+            }
+
+            if (node->OperIs(GT_STOREIND))
+            {
+                numStores++;
+            }
+        }
+    }
+
+    if (numStores == 0)
+    {
+        JITDUMP("  No stores; not a vectorization candidate\n");
+        return false;
+    }
+
+    JITDUMP("  " FMT_LP " is a vectorization candidate with %u stores\n", loop->GetIndex(), numStores);
+    return true;
+}
+#endif
+
 //------------------------------------------------------------------------
 // optInductionVariables: Try and optimize induction variables in the method.
 //
@@ -2884,6 +3000,16 @@ PhaseStatus Compiler::optInductionVariables()
             continue;
         }
 
+#ifdef DEBUG
+        // Checked before the IVs are rewritten below, since those transformations
+        // do not change whether the loop could be vectorized. Metrics are only
+        // reported in checked builds, so skip the analysis in release.
+        if (optIsLoopVectorizationCandidate(scevContext, loop))
+        {
+            Metrics.LoopsVectorizationCandidates++;
+        }
+#endif
+
         StrengthReductionContext strengthReductionContext(this, scevContext, loop, loopInfo);
         if (strengthReductionContext.TryStrengthReduce())
         {
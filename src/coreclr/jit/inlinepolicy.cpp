@@ -1399,13 +1399,25 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
                 JITDUMP("Callee has %s profile\n", m_HasProfileWeights ? "untrusted" : "no");
             }
 
+            // With profile data, the IL size limit also depends on how hot the call site is (see
+            // DetermineProfitability). The site frequency isn't known yet, so admit callees up to the
+            // largest profile-driven limit here and remember the limit ordinary sites get.
+            m_SiteMaxCodeSize = maxCodeSize;
+
+            if (m_HasProfileWeights && !m_IsPrejitRoot && m_RootCompiler->fgHaveSufficientProfileWeights() &&
+                !m_RootCompiler->opts.IsInstrumentedAndOptimized() && !m_RootCompiler->opts.IsOSR())
+            {
+                maxCodeSize = max(maxCodeSize, static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxILProf()));
+            }
+
             unsigned alwaysInlineSize = InlineStrategy::ALWAYS_INLINE_SIZE;
             if (m_InsideThrowBlock)
             {
                 // Inline only small code in BBJ_THROW blocks, e.g. <= 8 bytes of IL
                 JITDUMP("Call site in throw block\n");
                 alwaysInlineSize /= 2;
-                maxCodeSize = min(alwaysInlineSize + 1, maxCodeSize);
+                maxCodeSize       = min(alwaysInlineSize + 1, maxCodeSize);
+                m_SiteMaxCodeSize = min(alwaysInlineSize + 1, m_SiteMaxCodeSize);
             }
 
             if (m_IsForceInline)
@@ -1512,6 +1524,52 @@ unsigned ExtendedDefaultPolicy::EstimatedTotalILSize() const
     return (unsigned)codeSize;
 }
 
+//------------------------------------------------------------------------
+// DetermineProfitability: determine if this inline is profitable
+//
+// Arguments:
+//    methodInfo -- method info for the callee
+//
+// Notes:
+//    With profile data, the IL size limit is chosen per call site: sites at
+//    least JitExtDefaultPolicyHotSiteFreq may inline callees up to
+//    JitExtDefaultPolicyMaxILProf, sites below JitExtDefaultPolicyColdSiteFreq
+//    are limited to JitExtDefaultPolicyMaxIL, and the rest keep the limit
+//    computed when the IL size was noted. This is only decided here, once the
+//    call site frequency has been observed.
+
+void ExtendedDefaultPolicy::DetermineProfitability(CORINFO_METHOD_INFO* methodInfo)
+{
+    assert(InlDecisionIsCandidate(m_Decision));
+
+    if (m_HasProfileWeights && !m_IsPrejitRoot && m_RootCompiler->fgHaveSufficientProfileWeights())
+    {
+        const double hotSiteFreq  = (double)JitConfig.JitExtDefaultPolicyHotSiteFreq() / 10.0;
+        const double coldSiteFreq = (double)JitConfig.JitExtDefaultPolicyColdSiteFreq() / 10.0;
+
+        unsigned siteMaxCodeSize = m_SiteMaxCodeSize;
+        if (m_ProfileFrequency >= hotSiteFreq)
+        {
+            JITDUMP("Hot call site (frequency %g). Callee IL size %u allowed\n", m_ProfileFrequency, m_CodeSize);
+            siteMaxCodeSize = m_CodeSize;
+        }
+        else if (m_ProfileFrequency < coldSiteFreq)
+        {
+            siteMaxCodeSize = min(siteMaxCodeSize, static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxIL()));
+        }
+
+        if (m_CodeSize > siteMaxCodeSize)
+        {
+            JITDUMP("Callee IL size %u exceeds maxCodeSize %u for call site frequency %g\n", m_CodeSize,
+                    siteMaxCodeSize, m_ProfileFrequency);
+            SetFailure(InlineObservation::CALLSITE_TOO_MUCH_IL_FOR_FREQ);
+            return;
+        }
+    }
+
+    DefaultPolicy::DetermineProfitability(methodInfo);
+}
+
 //------------------------------------------------------------------------
 // DetermineMultiplier: determine benefit multiplier for this inline
 //
@@ -199,6 +199,7 @@ public:
     ExtendedDefaultPolicy(Compiler* compiler, bool isPrejitRoot)
         : DefaultPolicy(compiler, isPrejitRoot)
         , m_ProfileFrequency(0.0)
+        , m_SiteMaxCodeSize(0)
         , m_BinaryExprWithCns(0)
         , m_ArgCasted(0)
         , m_ArgIsStructByValue(0)
@@ -237,6 +238,8 @@ public:
 
     double DetermineMultiplier() override;
 
+    void DetermineProfitability(CORINFO_METHOD_INFO* methodInfo) override;
+
     unsigned EstimatedTotalILSize() const override;
 
     bool RequiresPreciseScan() override
@@ -255,6 +258,7 @@ public:
 
 protected:
     double   m_ProfileFrequency;
+    unsigned m_SiteMaxCodeSize;
     unsigned m_BinaryExprWithCns;
     unsigned m_ArgCasted;
     unsigned m_ArgIsStructByValue;
@@ -651,6 +651,12 @@ RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxILRoot, "JitExtDefaultPolicyMaxILRo
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxILProf, "JitExtDefaultPolicyMaxILProf", 0x400)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, "JitExtDefaultPolicyMaxBB", 7)
 
+// Call site frequencies (relative to the root method entry, in tenths) above which a call site may use
+// JitExtDefaultPolicyMaxILProf, and below which it is limited to JitExtDefaultPolicyMaxIL, when the root
+// method has profile data.
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyHotSiteFreq, "JitExtDefaultPolicyHotSiteFreq", 0x50)
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyColdSiteFreq, "JitExtDefaultPolicyColdSiteFreq", 0x1)
+
 // Inliner uses the following formula for PGO-driven decisions:
 //
 //    BM = BM * ((1.0 - ProfTrust) + ProfWeight * ProfScale)
@@ -694,6 +700,13 @@ RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationMaxTypeChecks, "JitGuardedDevir
 // Various policies for GuardedDevirtualization (0x4B == 75)
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, "JitGuardedDevirtualizationChainLikelihood", 0x4B)
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationChainStatements, "JitGuardedDevirtualizationChainStatements", 1)
+
+// When the JIT decides the number of type checks, a polymorphic call site still gets several guesses
+// if its most likely classes (each at least 15% likely) together cover this percentage of the calls.
+// 0 disables this. (0x50 == 80)
+RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationPolymorphicCoverage,
+                       "JitGuardedDevirtualizationPolymorphicCoverage",
+                       0x50)
 CONFIG_STRING(JitGuardedDevirtualizationRange, "JitGuardedDevirtualizationRange")
 CONFIG_INTEGER(JitRandomGuardedDevirtualization, "JitRandomGuardedDevirtualization", 0)
 
@@ -808,6 +821,10 @@ RELEASE_CONFIG_INTEGER(JitEnableStrengthReduction, "JitEnableStrengthReduction",
 // Enable IV optimizations
 RELEASE_CONFIG_INTEGER(JitEnableInductionVariableOpts, "JitEnableInductionVariableOpts", 1)
 
+// With profile data, procedure splitting also moves blocks expected to run less than once per
+// this many calls of the method into the cold section. 0 means only rarely run blocks are cold.
+RELEASE_CONFIG_INTEGER(JitSplitColdCallRatio, "JitSplitColdCallRatio", 1000)
+
 // JitFunctionFile: Name of a file that contains a list of functions. If the currently compiled function is in the
 // file, certain other JIT config variables will be active. If the currently compiled function is not in the file,
 // the specific JIT config variables will not be active.
@@ -45,6 +45,7 @@ JITMETADATAMETRIC(WidenedIVs,                            int,              0)
 JITMETADATAMETRIC(UnusedIVsRemoved,                      int,              0)
 JITMETADATAMETRIC(LoopsMadeDownwardsCounted,             int,              0)
 JITMETADATAMETRIC(LoopsStrengthReduced,                  int,              0)
+JITMETADATAMETRIC(LoopsVectorizationCandidates,          int,              0)
 JITMETADATAMETRIC(VarsInSsa,                             int,              0)
 JITMETADATAMETRIC(HoistedExpressions,                    int,              0)
 JITMETADATAMETRIC(RedundantBranchesEliminated,           int,              JIT_METADATA_HIGHER_IS_BETTER)
@@ -89,6 +90,7 @@ JITMETADATAMETRIC(NewBoxedValueClassHelperCalls,         int,              0)
 JITMETADATAMETRIC(StackAllocatedBoxedValueClasses,       int,              0)
 JITMETADATAMETRIC(NewArrayHelperCalls,                   int,              0)
 JITMETADATAMETRIC(StackAllocatedArrays,                  int,              0)
+JITMETADATAMETRIC(StackAllocEscapesViaCallArg,           int,              0)
 JITMETADATAMETRIC(LocalAssertionCount,                   int,              0)
 JITMETADATAMETRIC(LocalAssertionOverflow,                int,              0)
 JITMETADATAMETRIC(MorphTrackedLocals,                    int,              0)
@@ -1214,9 +1214,10 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
         LIR::Range& switchBlockRange = LIR::AsRange(afterDefaultCondBlock);
         switchBlockRange.InsertAtEnd(switchValue);
 
-        // Try generating a bit test based switch first,
-        // if that's not possible a jump table based switch will be generated.
-        if (!TryLowerSwitchToBitTest(jumpTab, jumpCnt, targetCnt, afterDefaultCondBlock, switchValue,
+        // Try generating a value table (for switches that only select a constant) first, then
+        // a bit test based switch, if neither is possible a jump table based switch will be generated.
+        if (!TryLowerSwitchToValueTable(jumpTab, jumpCnt, afterDefaultCondBlock, switchValue) &&
+            !TryLowerSwitchToBitTest(jumpTab, jumpCnt, targetCnt, afterDefaultCondBlock, switchValue,
                                      defaultLikelihood))
         {
             JITDUMP("Lowering switch " FMT_BB ": using jump table expansion\n", originalSwitchBB->bbNum);
@@ -1510,6 +1511,256 @@ bool Lowering::TryLowerSwitchToBitTest(FlowEdge*   jumpTable[],
     return true;
 }
 
+//------------------------------------------------------------------------
+// TryLowerSwitchToValueTable: Attempts to transform a switch whose cases only store
+//     a constant to the same local into a table lookup.
+//
+// Arguments:
+//    jumpTable - The jump table
+//    jumpCount - The number of blocks in the jump table
+//    bbSwitch - The switch block
+//    switchValue - A LclVar node that provides the switch value
+//
+// Return value:
+//    true if the switch has been lowered to a table lookup
+//
+// Notes:
+//    State machines and mapping functions often end up with switches where every case
+//    block is just "lcl = C; goto join". If the constants fit in a single register when
+//    packed as equally sized fields, the switch and its case blocks are replaced by
+//    a branch-free extraction from an immediate "value table":
+//        lcl = ((table >> (switchValue * fieldBits)) & fieldMask) + minValue
+//        goto join
+//    The default case has already been handled by a JTRUE(GT(switchValue, jumpCount - 2))
+//    that LowerSwitch generates.
+//
+bool Lowering::TryLowerSwitchToValueTable(FlowEdge*   jumpTable[],
+                                          unsigned    jumpCount,
+                                          BasicBlock* bbSwitch,
+                                          GenTree*    switchValue)
+{
+    assert(jumpCount >= 2);
+    assert(bbSwitch->KindIs(BBJ_SWITCH));
+    assert(switchValue->OperIs(GT_LCL_VAR));
+
+    if (comp->opts.OptimizationDisabled())
+    {
+        return false;
+    }
+
+    const unsigned caseCount = jumpCount - 1;
+    const unsigned maxBits   = genTypeSize(TYP_I_IMPL) * 8;
+
+    // Every field needs at least one bit.
+    if (caseCount > maxBits)
+    {
+        return false;
+    }
+
+    int32_t     caseValues[genTypeSize(TYP_I_IMPL) * 8];
+    unsigned    lclNum    = BAD_VAR_NUM;
+    BasicBlock* joinBlock = nullptr;
+
+    for (unsigned i = 0; i < caseCount; i++)
+    {
+        BasicBlock* const caseBlock = jumpTable[i]->getDestinationBlock();
+
+        if (!caseBlock->KindIs(BBJ_ALWAYS) || (caseBlock == bbSwitch) || caseBlock->TargetIs(caseBlock) ||
+            !BasicBlock::sameEHRegion(bbSwitch, caseBlock))
+        {
+            return false;
+        }
+
+        if (joinBlock == nullptr)
+        {
+            joinBlock = caseBlock->GetTarget();
+        }
+        else if (!caseBlock->TargetIs(joinBlock))
+        {
+            return false;
+        }
+
+        // The case block must consist of a single "STORE_LCL_VAR(CNS_INT)".
+        GenTreeLclVar* store    = nullptr;
+        unsigned       cnsCount = 0;
+
+        for (GenTree* node : LIR::AsRange(caseBlock))
+        {
+            if (node->OperIs(GT_IL_OFFSET))
+            {
+                continue;
+            }
+
+            if (node->OperIs(GT_CNS_INT))
+            {
+                cnsCount++;
+            }
+            else if (node->OperIs(GT_STORE_LCL_VAR) && (store == nullptr))
+            {
+                store = node->AsLclVar();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if ((store == nullptr) || (cnsCount != 1) || !store->Data()->IsCnsIntOrI() ||
+            store->Data()->IsIconHandle() || (genActualType(store->Data()) != TYP_INT))
+        {
+            return false;
+        }
+
+        LclVarDsc* const varDsc = comp->lvaGetDesc(store);
+        if (!varTypeIsIntegral(varDsc) || (genActualType(varDsc) != TYP_INT))
+        {
+            return false;
+        }
+
+        if (lclNum == BAD_VAR_NUM)
+        {
+            lclNum = store->GetLclNum();
+        }
+        else if (store->GetLclNum() != lclNum)
+        {
+            return false;
+        }
+
+        caseValues[i] = static_cast<int32_t>(store->Data()->AsIntCon()->IconValue());
+    }
+
+    assert((lclNum != BAD_VAR_NUM) && (joinBlock != nullptr));
+
+    int64_t minValue = caseValues[0];
+    int64_t maxValue = caseValues[0];
+
+    for (unsigned i = 1; i < caseCount; i++)
+    {
+        minValue = min(minValue, static_cast<int64_t>(caseValues[i]));
+        maxValue = max(maxValue, static_cast<int64_t>(caseValues[i]));
+    }
+
+    // Use a power of two field size so the field offset can be computed with a shift.
+    const uint64_t span      = static_cast<uint64_t>(maxValue - minValue);
+    unsigned       fieldBits = 0;
+
+    if (span != 0)
+    {
+        fieldBits = 1;
+        while ((fieldBits < 32) && ((span >> fieldBits) != 0))
+        {
+            fieldBits *= 2;
+        }
+    }
+
+    const unsigned tableBits = fieldBits * caseCount;
+    if (tableBits > maxBits)
+    {
+        return false;
+    }
+
+    size_t table = 0;
+    for (unsigned i = 0; i < caseCount; i++)
+    {
+        table |= static_cast<size_t>(caseValues[i] - minValue) << (i * fieldBits);
+    }
+
+    JITDUMP("Lowering switch " FMT_BB " to value table for V%02u (%u x %u bits), join " FMT_BB "\n", bbSwitch->bbNum,
+            lclNum, caseCount, fieldBits, joinBlock->bbNum);
+
+    //
+    // Redirect the switch block to the join block and drop the case blocks that are now unreachable.
+    //
+
+    BBswtDesc* const switchTargets = bbSwitch->GetSwitchTargets();
+    FlowEdge** const succs         = switchTargets->GetSuccs();
+    const unsigned   succCount     = switchTargets->GetSuccCount();
+
+    for (unsigned i = 0; i < succCount; i++)
+    {
+        // LowerSwitch already moved the default case's reference to the default block over to the
+        // bounds check in the original switch block, so unless some other case also targets the
+        // default block, that edge has no references left from bbSwitch.
+        if (succs[i]->getDupCount() > 0)
+        {
+            comp->fgRemoveAllRefPreds(succs[i]->getDestinationBlock(), bbSwitch);
+        }
+    }
+
+    FlowEdge* const joinEdge = comp->fgAddRefPred(joinBlock, bbSwitch);
+    bbSwitch->SetKindAndTargetEdge(BBJ_ALWAYS, joinEdge);
+
+    for (unsigned i = 0; i < succCount; i++)
+    {
+        BasicBlock* const caseBlock = succs[i]->getDestinationBlock();
+
+        if ((caseBlock->bbRefs == 0) && !caseBlock->HasFlag(BBF_DONT_REMOVE))
+        {
+            comp->fgRemoveBlock(caseBlock, /* unreachable */ true);
+        }
+        else if (caseBlock->hasProfileWeight())
+        {
+            caseBlock->setBBProfileWeight(caseBlock->computeIncomingWeight());
+        }
+    }
+
+    //
+    // Replace the switch value with "lcl = ((table >> (switchValue << log2(fieldBits))) & fieldMask) + minValue".
+    //
+
+    LIR::Range& switchBlockRange = LIR::AsRange(bbSwitch);
+    switchBlockRange.Remove(switchValue);
+
+    GenTree* value;
+
+    if (fieldBits == 0)
+    {
+        value = comp->gtNewIconNode(static_cast<ssize_t>(minValue), TYP_INT);
+    }
+    else
+    {
+        var_types tableType  = (tableBits <= (genTypeSize(TYP_INT) * 8)) ? TYP_INT : TYP_LONG;
+        GenTree*  shiftCount = switchValue;
+
+        if (fieldBits > 1)
+        {
+            shiftCount = comp->gtNewOperNode(GT_LSH, genActualType(switchValue), switchValue,
+                                             comp->gtNewIconNode(genLog2(fieldBits), TYP_INT));
+        }
+
+        ssize_t fieldMask  = static_cast<ssize_t>((uint64_t(1) << fieldBits) - 1);
+        ssize_t tableValue = static_cast<ssize_t>(table);
+
+        if (tableType == TYP_INT)
+        {
+            fieldMask = static_cast<int32_t>(fieldMask);
+            tableValue = static_cast<int32_t>(tableValue);
+        }
+
+        GenTree* tableIcon = comp->gtNewIconNode(tableValue, tableType);
+        GenTree* shift     = comp->gtNewOperNode(GT_RSZ, tableType, tableIcon, shiftCount);
+        GenTree* mask      = comp->gtNewIconNode(fieldMask, tableType);
+        value              = comp->gtNewOperNode(GT_AND, tableType, shift, mask);
+
+        if (tableType != TYP_INT)
+        {
+            value = comp->gtNewCastNode(TYP_INT, value, /* fromUnsigned */ false, TYP_INT);
+        }
+
+        if (minValue != 0)
+        {
+            value = comp->gtNewOperNode(GT_ADD, TYP_INT, value,
+                                        comp->gtNewIconNode(static_cast<ssize_t>(minValue), TYP_INT));
+        }
+    }
+
+    GenTree*   store      = comp->gtNewStoreLclVarNode(lclNum, value);
+    LIR::Range storeRange = LIR::SeqTree(comp, store);
+    switchBlockRange.InsertAtEnd(std::move(storeRange));
+
+    return true;
+}
+
 //------------------------------------------------------------------------
 // LowerArg:
 //   Lower one argument of a call. This entails inserting putarg nodes between
@@ -416,6 +416,10 @@ private:
                                      BasicBlock* bbSwitch,
                                      GenTree*    switchValue,
                                      weight_t    defaultLikelihood);
+    bool     TryLowerSwitchToValueTable(FlowEdge*   jumpTable[],
+                                        unsigned    jumpCount,
+                                        BasicBlock* bbSwitch,
+                                        GenTree*    switchValue);
 
     void LowerCast(GenTree* node);
 
@@ -1169,6 +1169,14 @@ bool LinearScan::buildKillPositionsForNode(GenTree* tree, LsraLocation currentLo
         // if (!blockSequence[curBBSeqNum]->isRunRarely())
         if (enregisterLocalVars)
         {
+            // The kill mask and the preferences derived from it only depend on the register type of each
+            // interval, so compute them once per type rather than once per live variable. Methods with many
+            // live locals across many calls otherwise spend a large part of the build phase here.
+            const bool isCallKill = ((killMask.getLow() == RBM_INT_CALLEE_TRASH) || (killMask == RBM_CALLEE_TRASH));
+            RegisterType     cachedRegType        = TYP_UNDEF;
+            SingleTypeRegSet cachedRegsKillMask   = RBM_NONE;
+            SingleTypeRegSet cachedNewPreferences = RBM_NONE;
+
             VarSetOps::Iter iter(compiler, currentLiveVars);
             unsigned        varIndex = 0;
             while (iter.NextElem(&varIndex))
@@ -1189,9 +1197,14 @@ bool LinearScan::buildKillPositionsForNode(GenTree* tree, LsraLocation currentLo
                     {
                         continue;
                     }
-                Interval*  interval   = getIntervalForLocalVar(varIndex);
-                const bool isCallKill = ((killMask.getLow() == RBM_INT_CALLEE_TRASH) || (killMask == RBM_CALLEE_TRASH));
-                SingleTypeRegSet regsKillMask = killMask.GetRegSetForType(interval->registerType);
+                Interval* interval = getIntervalForLocalVar(varIndex);
+                if (interval->registerType != cachedRegType)
+                {
+                    cachedRegType        = interval->registerType;
+                    cachedRegsKillMask   = killMask.GetRegSetForType(cachedRegType);
+                    cachedNewPreferences = allRegs(cachedRegType) & (~cachedRegsKillMask);
+                }
+                SingleTypeRegSet regsKillMask = cachedRegsKillMask;
 
                 if (isCallKill)
                 {
@@ -1204,7 +1217,7 @@ bool LinearScan::buildKillPositionsForNode(GenTree* tree, LsraLocation currentLo
                 // See the "heuristics for writeThru intervals" in 'buildIntervals()'.
                 if (!interval->isWriteThru || !isCallKill)
                 {
-                    SingleTypeRegSet newPreferences = allRegs(interval->registerType) & (~regsKillMask);
+                    SingleTypeRegSet newPreferences = cachedNewPreferences;
 
                     if (newPreferences != RBM_NONE)
                     {
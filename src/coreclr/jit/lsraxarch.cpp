@@ -349,12 +349,13 @@ int LinearScan::BuildNode(GenTree* tree)
 
         case GT_BITCAST:
             assert(dstCount == 1);
-            // TODO-Xarch-apx: Revisit once extended EVEX is available. Currently limiting high GPR for int <-> float
+            // int <-> float moves (movd/movq) can only access the extended GPRs through the EVEX encoding.
             if (!tree->gtGetOp1()->isContained())
             {
                 if (varTypeUsesFloatReg(tree) && (varTypeUsesIntReg(tree->gtGetOp1())))
                 {
-                    BuildUse(tree->gtGetOp1(), lowGprRegs);
+                    BuildUse(tree->gtGetOp1(), ForceLowGprForApxIfNeeded(tree->gtGetOp1(), RBM_NONE,
+                                                                         getEvexIsSupported()));
                 }
                 else
                 {
@@ -367,10 +368,10 @@ int LinearScan::BuildNode(GenTree* tree)
             {
                 srcCount = 0;
             }
-            // TODO-Xarch-apx: Revisit once extended EVEX is available. Currently limiting high GPR for int <-> float
+
             if (varTypeUsesFloatReg(tree->gtGetOp1()) && (varTypeUsesIntReg(tree)))
             {
-                BuildDef(tree, lowGprRegs);
+                BuildDef(tree, ForceLowGprForApxIfNeeded(tree, RBM_NONE, getEvexIsSupported()));
             }
             else
             {
@@ -4536,10 +4536,11 @@ GenTree* Compiler::fgMorphPotentialTailCall(GenTreeCall* call)
                     assert(lvaIsImplicitByRefLocal(lvaTable[varDsc->lvFieldLclStart].lvParentLcl));
                     assert(fgGlobalMorph);
                 }
-                else if (varDsc->IsStackAllocatedObject())
+                else if (varDsc->IsStackAllocatedObject() && !doesMethodHaveStackObjectCallArg())
                 {
-                    // Stack allocated objects currently cannot be passed to callees
-                    // so won't be live at tail call sites.
+                    // Unless object allocation let a stack box's payload escape to a callee,
+                    // stack allocated objects are not passed to callees so won't be live at
+                    // tail call sites.
                 }
 #if FEATURE_FIXED_OUT_ARGS
                 else if (varNum == lvaOutgoingArgSpaceVar)
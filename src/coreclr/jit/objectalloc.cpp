@@ -1820,6 +1820,9 @@ void ObjectAllocator::AnalyzeParentStack(ArrayStack<GenTree*>* parentStack, unsi
     bool       keepChecking                  = true;
     bool       canLclVarEscapeViaParentStack = true;
     bool       isCopy                        = true;
+#ifdef DEBUG
+    bool isUserCallArg = false;
+#endif
     bool const isEnumeratorLocal             = lclDsc->lvIsEnumerator;
     bool       isAddress                     = parentStack->Top()->OperIs(GT_LCL_ADDR);
 
@@ -2155,6 +2158,15 @@ void ObjectAllocator::AnalyzeParentStack(ArrayStack<GenTree*>* parentStack, unsi
                         canLclVarEscapeViaParentStack = false;
                     }
                 }
+                else if (!isAddress && (parentIndex == 2) && IsUnboxedEntryThisArg(call, tree))
+                {
+                    JITDUMP("Box payload passed as this to unboxed entry [%06u]...\n", comp->dspTreeID(call));
+                    canLclVarEscapeViaParentStack = false;
+
+                    // Morph must now keep tail calls from outliving the box.
+                    //
+                    comp->setMethodHasStackObjectCallArg();
+                }
 
                 // Note there is nothing special here about the parent being a call. We could move all this processing
                 // up to the caller and handle any sort of tree that could lead to escapes this way.
@@ -2172,6 +2184,10 @@ void ObjectAllocator::AnalyzeParentStack(ArrayStack<GenTree*>* parentStack, unsi
                     JITDUMP("Enumerator V%02u passed to call...\n", lclNum);
                     canLclVarEscapeViaParentStack = !CheckForGuardedUse(block, parent, lclNum);
                 }
+
+#ifdef DEBUG
+                isUserCallArg = !call->IsHelperCall();
+#endif
                 break;
             }
 
@@ -2186,9 +2202,87 @@ void ObjectAllocator::AnalyzeParentStack(ArrayStack<GenTree*>* parentStack, unsi
         JITDUMP(" first escapes via [%06u]...[%06u]\n", comp->dspTreeID(parentStack->Top()),
                 comp->dspTreeID(parentStack->Top(parentIndex)));
         MarkLclVarAsEscaping(lclNum);
+
+#ifdef DEBUG
+        // Track how often the only thing keeping an object on the heap is that it is passed
+        // to a callee we know nothing about, as summarizing callees would recover these.
+        // Metrics are only reported in checked builds.
+        //
+        if (isUserCallArg)
+        {
+            comp->Metrics.StackAllocEscapesViaCallArg++;
+        }
+#endif
     }
 }
 
+//------------------------------------------------------------------------
+// IsUnboxedEntryThisArg: check if a box payload is passed as the 'this'
+//   of a devirtualized call to a value class method's unboxed entry.
+//
+// Arguments:
+//   call - call being examined
+//   tree - the call operand, which refers to the box
+//
+// Returns:
+//   true if tree is ADD(box, TARGET_POINTER_SIZE) feeding the 'this' of
+//   a direct call on a value class, and the callee has no way to hand
+//   the byref back to the caller.
+//
+// Notes:
+//   Devirtualization rewrites interface calls on boxed values (for
+//   instance IEquatable<T>.Equals in shared generic code) this way when
+//   the box itself can't be removed. The callee sees an ordinary byref
+//   'this', which may not be stored to the heap, so the box only escapes
+//   if the byref can flow out via the return value or a byref argument.
+//
+//   A tail call would pop the frame holding the box before the callee
+//   uses 'this', so calls that may become tail calls are not eligible.
+//
+bool ObjectAllocator::IsUnboxedEntryThisArg(GenTreeCall* call, GenTree* tree)
+{
+    if ((call->gtCallType != CT_USER_FUNC) || call->IsVirtual() || !call->gtArgs.HasThisPointer())
+    {
+        return false;
+    }
+
+    if (call->IsTailPrefixedCall() || call->IsImplicitTailCall())
+    {
+        return false;
+    }
+
+    if ((call->gtArgs.GetThisArg()->GetNode() != tree) || !tree->OperIs(GT_ADD) || !tree->TypeIs(TYP_BYREF) ||
+        !tree->gtGetOp2()->IsIntegralConst(TARGET_POINTER_SIZE))
+    {
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE const methodClass = comp->info.compCompHnd->getMethodClass(call->gtCallMethHnd);
+    if (!comp->info.compCompHnd->isValueClass(methodClass))
+    {
+        return false;
+    }
+
+    // A byref or struct return could carry the payload address back out.
+    //
+    if (call->ShouldHaveRetBufArg() || varTypeIsStruct(call->gtReturnType) || (call->gtReturnType == TYP_BYREF))
+    {
+        return false;
+    }
+
+    // So could a store through a byref argument.
+    //
+    for (CallArg& arg : call->gtArgs.Args())
+    {
+        if ((&arg != call->gtArgs.GetThisArg()) && arg.GetNode()->TypeIs(TYP_BYREF))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------
 // UpdateAncestorTypes: Update types of some ancestor nodes of a possibly-stack-pointing
 //                      tree from TYP_REF to TYP_BYREF or TYP_I_IMPL.
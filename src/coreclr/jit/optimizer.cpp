@@ -5184,6 +5184,21 @@ void Compiler::optComputeLoopSideEffectsOfBlock(BasicBlock* blk, FlowGraphNatura
                                 continue;
                             }
                         }
+
+                        // ...or if it is known to point to a field, treat this like a direct field store.
+                        GenTree*  baseAddr = nullptr;
+                        FieldSeq* fldSeq   = nullptr;
+                        ssize_t   offset   = 0;
+                        if (fgIsFieldAddrOfByrefLocal(argLcl, &baseAddr, &fldSeq, &offset))
+                        {
+                            FieldKindForVN fieldKind =
+                                (baseAddr != nullptr) ? FieldKindForVN::WithBaseAddr : FieldKindForVN::SimpleStatic;
+                            AddModifiedFieldAllContainingLoops(mostNestedLoop, fldSeq->GetFieldHandle(), fieldKind);
+                            // Conservatively assume byrefs may alias this object.
+                            memoryHavoc |= memoryKindSet(ByrefExposed);
+                            continue;
+                        }
+
                         // Otherwise...
                         memoryHavoc |= memoryKindSet(GcHeap, ByrefExposed);
                     }
@@ -1055,6 +1055,43 @@ private:
     }
 };
 
+//------------------------------------------------------------------------
+// CanPassArgAsFieldList:
+//   Check whether the ABI allows an argument to be passed as a FIELD_LIST of
+//   replacements.
+//
+// Parameters:
+//   abiInfo - ABI information of the argument
+//
+// Returns:
+//   True if the argument is passed by value and the backend can consume a
+//   FIELD_LIST for all of its segments.
+//
+// Remarks:
+//   Arguments passed entirely on the stack are supported on 64-bit targets.
+//   TODO-CQ: x86 pushes stack FIELD_LISTs a slot at a time and 32-bit targets
+//   need long fields decomposed, and split arguments would need their fields
+//   to line up with the split point; all of these still use write-backs.
+//
+static bool CanPassArgAsFieldList(const ABIPassingInformation& abiInfo)
+{
+    if (abiInfo.IsPassedByReference())
+    {
+        return false;
+    }
+
+    if (!abiInfo.HasAnyStackSegment())
+    {
+        return true;
+    }
+
+#ifdef TARGET_64BIT
+    return !abiInfo.HasAnyRegisterSegment();
+#else
+    return false;
+#endif
+}
+
 // Struct used to save all struct stores involving physical promotion candidates.
 // These stores can induce new field accesses as part of store decomposition.
 struct CandidateStore
@@ -1556,7 +1593,7 @@ private:
                     call->gtArgs.DetermineABIInfo(m_compiler, call);
                 }
 
-                if (!arg.AbiInfo.HasAnyStackSegment() && !arg.AbiInfo.IsPassedByReference())
+                if (CanPassArgAsFieldList(arg.AbiInfo))
                 {
                     flags |= AccessKindFlags::IsRegCallArg;
                 }
@@ -2143,7 +2180,7 @@ void ReplaceVisitor::InsertPreStatementWriteBacks()
 
                     if (m_replacer->CanReplaceCallArgWithFieldListOfReplacements(call, &arg, node->AsLclVarCommon()))
                     {
-                        // Register arg that can be decomposed into FIELD_LIST.
+                        // Arg that can be decomposed into FIELD_LIST.
                         continue;
                     }
 
@@ -2400,6 +2437,41 @@ bool ReplaceVisitor::ReplaceCallArgWithFieldList(GenTreeCall* call, GenTreeLclVa
     GenTreeFieldList* fieldList = m_compiler->gtNewFieldList();
     for (const ABIPassingSegment& seg : callArg->AbiInfo.Segments())
     {
+        if (seg.IsPassedOnStack())
+        {
+            // Stack segments are passed as a sequence of the up-to-date
+            // replacements inside the segment, with the remaining bytes read
+            // directly from the struct local.
+            unsigned segStart = argNode->GetLclOffs() + seg.Offset;
+            unsigned segEnd   = argNode->GetLclOffs() + min(seg.Offset + seg.Size, layout->GetSize());
+            unsigned offs     = segStart;
+
+            auto addReplacement = [=, &offs, &deaths](Replacement& rep) {
+                if (rep.NeedsReadBack)
+                {
+                    // The struct local is up to date, read it from there.
+                    return true;
+                }
+
+                AddUnpromotedFieldsToFieldList(fieldList, argNode, offs, rep.Offset);
+
+                GenTreeLclVar* fieldValue = m_compiler->gtNewLclvNode(rep.LclNum, rep.AccessType);
+                if (deaths.IsReplacementDying(static_cast<unsigned>(&rep - agg->Replacements.data())))
+                {
+                    fieldValue->gtFlags |= GTF_VAR_DEATH;
+                    CheckForwardSubForLastUse(rep.LclNum);
+                }
+
+                fieldList->AddField(m_compiler, fieldValue, rep.Offset - argNode->GetLclOffs(), rep.AccessType);
+                offs = rep.Offset + genTypeSize(rep.AccessType);
+                return true;
+            };
+
+            VisitOverlappingReplacements(argNode->GetLclNum(), segStart, segEnd - segStart, addReplacement);
+            AddUnpromotedFieldsToFieldList(fieldList, argNode, offs, segEnd);
+            continue;
+        }
+
         Replacement* rep = nullptr;
         if (agg->OverlappingReplacements(argNode->GetLclOffs() + seg.Offset, seg.Size, &rep, nullptr) &&
             !rep->NeedsReadBack)
@@ -2456,6 +2528,75 @@ bool ReplaceVisitor::ReplaceCallArgWithFieldList(GenTreeCall* call, GenTreeLclVa
     return true;
 }
 
+//------------------------------------------------------------------------
+// AddUnpromotedFieldsToFieldList:
+//   Add fields that read a range of a struct local directly from the local
+//   to a FIELD_LIST being created for a stack-passed argument.
+//
+// Parameters:
+//   fieldList - The field list
+//   argNode   - The struct local that is being passed
+//   start     - Start offset of the range, relative to the local
+//   end       - End offset of the range, relative to the local
+//
+// Remarks:
+//   Bytes that are padding in the layout are skipped. The range is read in
+//   naturally aligned primitive pieces, with pointer-sized slots using the
+//   GC type from the layout.
+//
+void ReplaceVisitor::AddUnpromotedFieldsToFieldList(GenTreeFieldList*    fieldList,
+                                                    GenTreeLclVarCommon* argNode,
+                                                    unsigned             start,
+                                                    unsigned             end)
+{
+    ClassLayout*       layout     = argNode->GetLayout(m_compiler);
+    const SegmentList& nonPadding = layout->GetNonPadding(m_compiler);
+
+    unsigned offs = start;
+    while (offs < end)
+    {
+        unsigned  layoutOffset = offs - argNode->GetLclOffs();
+        unsigned  remaining    = end - offs;
+        unsigned  size;
+        var_types type;
+        if (((layoutOffset % TARGET_POINTER_SIZE) == 0) && (remaining >= TARGET_POINTER_SIZE))
+        {
+            size = TARGET_POINTER_SIZE;
+            type = layout->GetGCPtrType(layoutOffset / TARGET_POINTER_SIZE);
+        }
+        else if (((layoutOffset % 4) == 0) && (remaining >= 4))
+        {
+            size = 4;
+            type = TYP_INT;
+        }
+        else if (((layoutOffset % 2) == 0) && (remaining >= 2))
+        {
+            size = 2;
+            type = TYP_USHORT;
+        }
+        else
+        {
+            size = 1;
+            type = TYP_UBYTE;
+        }
+
+        assert(!layout->IntersectsGCPtr(layoutOffset, size) || varTypeIsGC(type));
+
+        if (nonPadding.Intersects(SegmentList::Segment(layoutOffset, layoutOffset + size)))
+        {
+            GenTree* fieldValue = m_compiler->gtNewLclFldNode(argNode->GetLclNum(), type, offs);
+            fieldList->AddField(m_compiler, fieldValue, layoutOffset, type);
+
+            if (!m_compiler->lvaGetDesc(argNode->GetLclNum())->lvDoNotEnregister)
+            {
+                m_compiler->lvaSetVarDoNotEnregister(argNode->GetLclNum() DEBUGARG(DoNotEnregisterReason::LocalField));
+            }
+        }
+
+        offs += size;
+    }
+}
+
 //------------------------------------------------------------------------
 // CanReplaceCallArgWithFieldListOfReplacements:
 //   Returns true if a struct arg is replaceable by a FIELD_LIST containing
@@ -2477,7 +2618,7 @@ bool ReplaceVisitor::CanReplaceCallArgWithFieldListOfReplacements(GenTreeCall*
     // We should have computed ABI information during the costing phase.
     assert(call->gtArgs.IsAbiInformationDetermined());
 
-    if (callArg->AbiInfo.HasAnyStackSegment() || callArg->AbiInfo.IsPassedByReference())
+    if (!CanPassArgAsFieldList(callArg->AbiInfo))
     {
         return false;
     }
@@ -2485,9 +2626,54 @@ bool ReplaceVisitor::CanReplaceCallArgWithFieldListOfReplacements(GenTreeCall*
     AggregateInfo* agg = m_aggregates.Lookup(lcl->GetLclNum());
     assert(agg != nullptr);
 
+    ClassLayout* layout = lcl->GetLayout(m_compiler);
+
     bool anyReplacements = false;
     for (const ABIPassingSegment& seg : callArg->AbiInfo.Segments())
     {
+        if (seg.IsPassedOnStack())
+        {
+            unsigned segStart = lcl->GetLclOffs() + seg.Offset;
+            unsigned segEnd   = lcl->GetLclOffs() + min(seg.Offset + seg.Size, layout->GetSize());
+
+            auto stackCallback = [=, &anyReplacements](Replacement& rep) {
+                anyReplacements = true;
+
+                // Replacement must be entirely inside the segment...
+                unsigned repSize = genTypeSize(rep.AccessType);
+                if ((rep.Offset < segStart) || (rep.Offset + repSize > segEnd))
+                {
+                    return false;
+                }
+
+#ifdef FEATURE_SIMD
+                // ...must be storable to the outgoing area without widening...
+                if (rep.AccessType == TYP_SIMD12)
+                {
+                    return false;
+                }
+#endif
+
+                // ...and must not partially overlap GC pointers, since the
+                // remainder would be read as a non-GC field.
+                unsigned layoutOffset = rep.Offset - lcl->GetLclOffs();
+                if (layout->IntersectsGCPtr(layoutOffset, repSize) &&
+                    (!varTypeIsGC(rep.AccessType) || ((layoutOffset % TARGET_POINTER_SIZE) != 0)))
+                {
+                    return false;
+                }
+
+                return true;
+            };
+
+            if (!VisitOverlappingReplacements(lcl->GetLclNum(), segStart, segEnd - segStart, stackCallback))
+            {
+                return false;
+            }
+
+            continue;
+        }
+
         assert(seg.IsPassedInRegister());
 
         auto callback = [=, &anyReplacements, &seg](Replacement& rep) {
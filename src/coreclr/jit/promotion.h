@@ -298,6 +298,10 @@ private:
     bool ReplaceReturnedStructLocal(GenTreeOp* ret, GenTreeLclVarCommon* value);
     bool ReplaceCallArgWithFieldList(GenTreeCall* call, GenTreeLclVarCommon* callArg);
     bool CanReplaceCallArgWithFieldListOfReplacements(GenTreeCall* call, CallArg* callArg, GenTreeLclVarCommon* lcl);
+    void AddUnpromotedFieldsToFieldList(GenTreeFieldList*    fieldList,
+                                        GenTreeLclVarCommon* argNode,
+                                        unsigned             start,
+                                        unsigned             end);
     void ReadBackAfterCall(GenTreeCall* call, GenTree* user);
     bool IsPromotedStructLocalDying(GenTreeLclVarCommon* structLcl);
     void ReplaceLocal(GenTree** use, GenTree* user);
@@ -50,6 +50,9 @@ RangeCheck::RangeCheck(Compiler* pCompiler)
     , m_pOverflowMap(nullptr)
     , m_pRangeMap(nullptr)
     , m_pSearchPath(nullptr)
+    , m_blockToLoop(nullptr)
+    , m_scevContext(nullptr)
+    , m_scevLoop(nullptr)
     , m_pCompiler(pCompiler)
     , m_alloc(pCompiler->getAllocator(CMK_RangeCheck))
     , m_nVisitBudget(MAX_VISIT_BUDGET)
@@ -394,37 +397,289 @@ void RangeCheck::OptimizeRangeCheck(BasicBlock* block, Statement* stmt, GenTree*
     if (!TryGetRange(block, treeIndex, &range))
     {
         JITDUMP("Failed to get range\n");
-        return;
+    }
+    // If upper or lower limit is found to be unknown (top), or it was found to
+    // be unknown because of over budget or a deep search, then skip widening.
+    // Note: If we had stack depth too deep in the GetRangeWorker call, we'd be
+    // too deep even in the DoesOverflow call.
+    else if (!range.UpperLimit().IsUnknown() && !range.LowerLimit().IsUnknown())
+    {
+        JITDUMP("Range value %s\n", range.ToString(m_pCompiler));
+        ClearSearchPath();
+        Widen(block, treeIndex, &range);
+
+        // Is the range between the lower and upper bound values.
+        if (!range.UpperLimit().IsUnknown() && !range.LowerLimit().IsUnknown() &&
+            BetweenBounds(range, bndsChk->GetArrayLength(), arrSize))
+        {
+            JITDUMP("[RangeCheck::OptimizeRangeCheck] Between bounds\n");
+            m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
+            m_updateStmt = true;
+            return;
+        }
     }
 
-    assert(range.IsValid());
+    // The def-use based analysis above only follows the index through monotonic
+    // phis; indices whose start or bound depend on an enclosing loop are better
+    // described by the add recurrence of the innermost loop.
+    Range scevRange = Range(Limit(Limit::keUndef));
+    if (TryGetRangeFromScev(block, treeIndex, &scevRange) &&
+        BetweenBounds(scevRange, bndsChk->GetArrayLength(), arrSize))
+    {
+        JITDUMP("[RangeCheck::OptimizeRangeCheck] Between bounds via scalar evolution\n");
+        m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
+        m_updateStmt = true;
+    }
+}
 
-    // If upper or lower limit is found to be unknown (top), or it was found to
-    // be unknown because of over budget or a deep search, then return early.
-    if (range.UpperLimit().IsUnknown() || range.LowerLimit().IsUnknown())
+//------------------------------------------------------------------------
+// TryGetRangeFromScev: Compute the range of an index that is an add
+//   recurrence of the innermost loop containing it.
+//
+// Arguments:
+//    block  - the block containing the bounds check
+//    expr   - the index expression
+//    pRange - [out] the range of the index over all iterations of the loop
+//
+// Return Value:
+//    True if the index is an increasing add recurrence of a counted loop and
+//    both its first and last values could be expressed as limits.
+//
+// Notes:
+//    The loop must have a single exit that dominates all backedges, so that
+//    the index takes the values <start, start + step, ..., start + step * N>
+//    where N is the backedge count. Values depending on enclosing loops are
+//    bounded through the assertions available at the block. The last value
+//    is bounded in 64 bits, and the range is rejected unless that shows the
+//    recurrence cannot wrap.
+//
+bool RangeCheck::TryGetRangeFromScev(BasicBlock* block, GenTree* expr, Range* pRange)
+{
+    if (!expr->TypeIs(TYP_INT))
     {
-        // Note: If we had stack depth too deep in the GetRangeWorker call, we'd be
-        // too deep even in the DoesOverflow call. So return early.
-        return;
+        return false;
     }
 
-    JITDUMP("Range value %s\n", range.ToString(m_pCompiler));
-    ClearSearchPath();
-    Widen(block, treeIndex, &range);
+    if (m_blockToLoop == nullptr)
+    {
+        m_pCompiler->optReachableBitVecTraits = nullptr;
+
+        if (m_pCompiler->m_dfsTree == nullptr)
+        {
+            m_pCompiler->m_dfsTree = m_pCompiler->fgComputeDfs();
+        }
+
+        if (m_pCompiler->m_domTree == nullptr)
+        {
+            m_pCompiler->m_domTree = FlowGraphDominatorTree::Build(m_pCompiler->m_dfsTree);
+        }
+
+        if (m_pCompiler->m_loops == nullptr)
+        {
+            m_pCompiler->m_loops = FlowGraphNaturalLoops::Find(m_pCompiler->m_dfsTree);
+        }
+
+        m_blockToLoop = BlockToNaturalLoopMap::Build(m_pCompiler->m_loops);
+        m_scevContext = new (m_alloc) ScalarEvolutionContext(m_pCompiler);
+    }
 
-    // If upper or lower limit is unknown, then return.
-    if (range.UpperLimit().IsUnknown() || range.LowerLimit().IsUnknown())
+    FlowGraphNaturalLoop* loop = m_blockToLoop->GetLoop(block);
+    if ((loop == nullptr) || (loop->ExitEdges().size() != 1))
     {
-        return;
+        return false;
     }
 
-    // Is the range between the lower and upper bound values.
-    if (BetweenBounds(range, bndsChk->GetArrayLength(), arrSize))
+    BasicBlock* exiting = loop->ExitEdge(0)->getSourceBlock();
+    if (!exiting->KindIs(BBJ_COND))
     {
-        JITDUMP("[RangeCheck::OptimizeRangeCheck] Between bounds\n");
-        m_pCompiler->optRemoveRangeCheck(bndsChk, comma, stmt);
-        m_updateStmt = true;
+        return false;
+    }
+
+    for (FlowEdge* backEdge : loop->BackEdges())
+    {
+        if (!m_pCompiler->m_domTree->Dominates(exiting, backEdge->getSourceBlock()))
+        {
+            return false;
+        }
+    }
+
+    if (m_scevLoop != loop)
+    {
+        m_scevContext->ResetForLoop(loop);
+        m_scevLoop = loop;
+    }
+
+    Scev* scev = m_scevContext->Analyze(block, expr);
+    if (scev == nullptr)
+    {
+        return false;
     }
+
+    scev = m_scevContext->Simplify(scev);
+    if (!scev->OperIs(ScevOper::AddRec))
+    {
+        return false;
+    }
+
+    ScevAddRec* addRec = (ScevAddRec*)scev;
+    int64_t     step;
+    if (!addRec->Step->GetConstantValue(m_pCompiler, &step) || (step <= 0) || (step > INT32_MAX))
+    {
+        return false;
+    }
+
+    Scev* backedgeCount = m_scevContext->ComputeExitNotTakenCount(exiting);
+    if ((backedgeCount == nullptr) || (backedgeCount->Type != addRec->Type))
+    {
+        return false;
+    }
+
+    JITDUMP("Index [%06u] is ", Compiler::dspTreeID(expr));
+    DBEXEC(m_pCompiler->verbose, addRec->Dump(m_pCompiler));
+    JITDUMP(" with backedge count ");
+    DBEXEC(m_pCompiler->verbose, backedgeCount->Dump(m_pCompiler));
+    JITDUMP("\n");
+
+    // Scalar evolution does not guarantee that the TYP_INT recurrence doesn't
+    // wrap, so bound its last value start + step * N in 64 bits from upper
+    // limits of start and N, and only accept it if that provably stays within
+    // int range (and, when relative to a bound, does not exceed the bound).
+    //
+    Limit lower;
+    Limit startUpper;
+    Limit countUpper;
+    if (!TryGetLimitFromScev(block, addRec->Start, /* isUpper */ false, &lower) ||
+        !TryGetLimitFromScev(block, addRec->Start, /* isUpper */ true, &startUpper) ||
+        !TryGetLimitFromScev(block, backedgeCount, /* isUpper */ true, &countUpper))
+    {
+        return false;
+    }
+
+    if (countUpper.IsConstant() && (countUpper.GetConstant() < 0))
+    {
+        return false;
+    }
+
+    Limit upper;
+    if (startUpper.IsConstant() && countUpper.IsConstant())
+    {
+        int64_t lastCns = (int64_t)startUpper.GetConstant() + step * (int64_t)countUpper.GetConstant();
+        if (lastCns > INT32_MAX)
+        {
+            return false;
+        }
+
+        upper = Limit(Limit::keConstant, (int)lastCns);
+    }
+    else if (startUpper.IsBinOpArray() && countUpper.IsConstant())
+    {
+        int64_t lastCns = (int64_t)startUpper.GetConstant() + step * (int64_t)countUpper.GetConstant();
+        if (lastCns > 0)
+        {
+            return false;
+        }
+
+        upper = Limit(Limit::keBinOpArray, startUpper.vn, (int)lastCns);
+    }
+    else if (startUpper.IsConstant() && countUpper.IsBinOpArray() && (step == 1) && (countUpper.GetConstant() <= 0))
+    {
+        int64_t lastCns = (int64_t)startUpper.GetConstant() + countUpper.GetConstant();
+        if ((lastCns < INT32_MIN) || (lastCns > 0))
+        {
+            return false;
+        }
+
+        upper = Limit(Limit::keBinOpArray, countUpper.vn, (int)lastCns);
+    }
+    else
+    {
+        return false;
+    }
+
+    *pRange = Range(lower, upper);
+    JITDUMP("Range from scalar evolution %s\n", pRange->ToString(m_pCompiler));
+    return true;
+}
+
+//------------------------------------------------------------------------
+// TryGetLimitFromScev: Express a loop invariant SCEV as a limit.
+//
+// Arguments:
+//    block   - the block where the limit is needed
+//    scev    - the SCEV
+//    isUpper - true if an upper limit is wanted, false for a lower limit
+//    pLimit  - [out] the limit
+//
+// Return Value:
+//    True if the SCEV is a constant, a checked bound plus a constant, or a
+//    value plus a constant where the value has a suitable limit from the
+//    assertions at the block.
+//
+bool RangeCheck::TryGetLimitFromScev(BasicBlock* block, Scev* scev, bool isUpper, Limit* pLimit)
+{
+    int64_t cns;
+    if (scev->GetConstantValue(m_pCompiler, &cns))
+    {
+        if ((cns < INT32_MIN) || (cns > INT32_MAX))
+        {
+            return false;
+        }
+
+        *pLimit = Limit(Limit::keConstant, (int)cns);
+        return true;
+    }
+
+    ValueNumStore* vnStore = m_pCompiler->vnStore;
+    ValueNum       vn      = m_scevContext->MaterializeVN(scev).GetConservative();
+    if (vn == ValueNumStore::NoVN)
+    {
+        return false;
+    }
+
+    ValueNum  baseVN = vn;
+    int       offset = 0;
+    VNFuncApp funcApp;
+    if (vnStore->GetVNFunc(vn, &funcApp) && (funcApp.m_func == (VNFunc)GT_ADD))
+    {
+        if (vnStore->IsVNInt32Constant(funcApp.m_args[1]))
+        {
+            baseVN = funcApp.m_args[0];
+            offset = vnStore->GetConstantInt32(funcApp.m_args[1]);
+        }
+        else if (vnStore->IsVNInt32Constant(funcApp.m_args[0]))
+        {
+            baseVN = funcApp.m_args[1];
+            offset = vnStore->GetConstantInt32(funcApp.m_args[0]);
+        }
+    }
+
+    if (vnStore->IsVNCheckedBound(baseVN))
+    {
+        *pLimit = Limit(Limit::keBinOpArray, baseVN, offset);
+        return true;
+    }
+
+    Range baseRange = Range(Limit(Limit::keUnknown));
+    if (!TryGetRangeFromAssertions(m_pCompiler, baseVN, block->bbAssertionIn, &baseRange))
+    {
+        return false;
+    }
+
+    Limit baseLimit = isUpper ? baseRange.UpperLimit() : baseRange.LowerLimit();
+    if (!baseLimit.IsConstant() && !baseLimit.IsBinOpArray())
+    {
+        return false;
+    }
+
+    int64_t limitCns = (int64_t)baseLimit.GetConstant() + offset;
+    if ((limitCns < INT32_MIN) || (limitCns > INT32_MAX))
+    {
+        return false;
+    }
+
+    *pLimit = baseLimit.IsConstant() ? Limit(Limit::keConstant, (int)limitCns)
+                                     : Limit(Limit::keBinOpArray, baseLimit.vn, (int)limitCns);
+    return true;
 }
 
 void RangeCheck::Widen(BasicBlock* block, GenTree* tree, Range* pRange)
@@ -1813,6 +2068,9 @@ bool RangeCheck::OptimizeRangeChecks()
     // Reset the budget in case of JitOptRepeat.
     m_nVisitBudget   = MAX_VISIT_BUDGET;
     m_preferredBound = ValueNumStore::NoVN;
+    m_blockToLoop    = nullptr;
+    m_scevContext    = nullptr;
+    m_scevLoop       = nullptr;
 
     bool madeChanges = false;
 
@@ -836,6 +836,13 @@ private:
     // Given a lclvar use, try to find the lclvar's defining store and its containing block.
     LclSsaVarDsc* GetSsaDefStore(GenTreeLclVarCommon* lclUse);
 
+    // Compute the range of an index that is an add recurrence of its innermost loop, using
+    // scalar evolution and the backedge count of the loop.
+    bool TryGetRangeFromScev(BasicBlock* block, GenTree* expr, Range* pRange);
+
+    // Convert a loop invariant SCEV into a lower or upper limit, using assertions for symbolic values.
+    bool TryGetLimitFromScev(BasicBlock* block, Scev* scev, bool isUpper, Limit* pLimit);
+
     // When we have this bound and a constant, we prefer to use this bound (if set)
     ValueNum m_preferredBound;
 
@@ -853,6 +860,11 @@ private:
     void        ClearSearchPath();
     SearchPath* m_pSearchPath;
 
+    // Loop and scalar evolution state, created on demand by TryGetRangeFromScev.
+    BlockToNaturalLoopMap*  m_blockToLoop;
+    ScalarEvolutionContext* m_scevContext;
+    FlowGraphNaturalLoop*   m_scevLoop;
+
     Compiler*     m_pCompiler;
     CompAllocator m_alloc;
 
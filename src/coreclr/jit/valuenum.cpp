@@ -6365,6 +6365,44 @@ void Compiler::fgValueNumberArrayElemStore(GenTree* storeNode, VNFuncApp* addrFu
     }
 }
 
+//------------------------------------------------------------------------
+// fgIsFieldAddrOfByrefLocal: Check whether an address is a byref local whose
+//    (single, SSA) definition is the address of a class/static field.
+//
+// Arguments:
+//    addr      - The address to check
+//    pBaseAddr - [out] The "base address" of the field (see "GenTree::IsFieldAddr")
+//    pFldSeq   - [out] The field sequence representing the address
+//    pOffset   - [out] The offset, relative to the field, of the address
+//
+// Return Value:
+//    Whether "addr" is such a local, in which case memory accesses through it
+//    can be modeled as accesses to the field itself.
+//
+// Notes:
+//    This covers "ref T x = ref obj.Field" style locals, which are otherwise
+//    opaque and force a loop containing stores through them to invalidate all
+//    of the GC heap.
+//
+bool Compiler::fgIsFieldAddrOfByrefLocal(GenTree* addr, GenTree** pBaseAddr, FieldSeq** pFldSeq, ssize_t* pOffset)
+{
+    if (!addr->OperIs(GT_LCL_VAR) || !addr->TypeIs(TYP_BYREF) || !addr->AsLclVar()->HasSsaName())
+    {
+        return false;
+    }
+
+    GenTreeLclVar* const       lclNode = addr->AsLclVar();
+    GenTreeLclVarCommon* const defNode = lvaGetDesc(lclNode)->GetPerSsaData(lclNode->GetSsaNum())->GetDefNode();
+
+    if ((defNode == nullptr) || !defNode->OperIs(GT_STORE_LCL_VAR))
+    {
+        return false;
+    }
+
+    GenTree* const data = defNode->Data()->gtEffectiveVal();
+    return data->TypeIs(TYP_BYREF) && data->IsFieldAddr(this, pBaseAddr, pFldSeq, pOffset);
+}
+
 //------------------------------------------------------------------------
 // fgValueNumberFieldLoad: Value number a class/static field load.
 //
@@ -12135,7 +12173,8 @@ void Compiler::fgValueNumberStore(GenTree* store)
             {
                 fgValueNumberArrayElemStore(store, &funcApp, storeSize, valueVNPair.GetLiberal());
             }
-            else if (addr->IsFieldAddr(this, &baseAddr, &fldSeq, &offset))
+            else if (addr->IsFieldAddr(this, &baseAddr, &fldSeq, &offset) ||
+                     fgIsFieldAddrOfByrefLocal(addr, &baseAddr, &fldSeq, &offset))
             {
                 assert(fldSeq != nullptr);
                 fgValueNumberFieldStore(store, baseAddr, fldSeq, offset, storeSize, valueVNPair.GetLiberal());
@@ -12787,7 +12826,8 @@ void Compiler::fgValueNumberTree(GenTree* tree)
                 {
                     fgValueNumberArrayElemLoad(tree, &funcApp);
                 }
-                else if (addr->IsFieldAddr(this, &baseAddr, &fldSeq, &offset))
+                else if (addr->IsFieldAddr(this, &baseAddr, &fldSeq, &offset) ||
+                         fgIsFieldAddrOfByrefLocal(addr, &baseAddr, &fldSeq, &offset))
                 {
                     assert(fldSeq != nullptr);
                     fgValueNumberFieldLoad(tree, baseAddr, fldSeq, offset);
@@ -69,6 +69,11 @@ bool InitializeGC()
         GetRuntimeInstance()->EnableConservativeStackReporting();
     }
 
+    // A mean of 0 would sample every allocation, which is what a mean of 1 already does. The config value
+    // is 64-bit but the mean is reported as a UInt32 in the AllocationSampled event.
+    ee_alloc_context::s_samplingDistributionMean =
+        (uint32_t)min(max(g_pRhConfig->GetAllocationSamplingMean(), (uint64_t)1), (uint64_t)UINT32_MAX);
+
     HRESULT hr = GCHeapUtilities::InitializeGC();
     if (FAILED(hr))
         return false;
@@ -500,7 +505,8 @@ void FireAllocationSampled(GC_ALLOC_FLAGS flags, size_t size, size_t samplingBud
             (flags & GC_ALLOC_PINNED_OBJECT_HEAP) ? 2 :
             (flags & GC_ALLOC_LARGE_OBJECT_HEAP) ? 1 :
             0;  // SOH
-        FireEtwAllocationSampled(allocKind, GetClrInstanceId(), typeId, name, (BYTE*)orObject, size, samplingBudgetOffset);
+        FireEtwAllocationSampled_V1(allocKind, GetClrInstanceId(), typeId, name, (BYTE*)orObject, size, samplingBudgetOffset,
+            ee_alloc_context::s_samplingDistributionMean);
     }
 #endif
 }
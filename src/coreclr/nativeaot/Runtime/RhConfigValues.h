@@ -14,6 +14,7 @@ RETAIL_CONFIG_VALUE(StressLogLevel)
 RETAIL_CONFIG_VALUE(TotalStressLogSize)
 RETAIL_CONFIG_VALUE(gcServer)
 RETAIL_CONFIG_VALUE(gcConservative)         // Enables conservative stack reporting
+RETAIL_CONFIG_VALUE_WITH_DEFAULT(AllocationSamplingMean, 100 * 1024) // Mean number of bytes allocated between two AllocationSampled events
 DEBUG_CONFIG_VALUE(GcStressThrottleMode)    // gcstm_TriggerAlways / gcstm_TriggerOnFirstHit / gcstm_TriggerRandom
 DEBUG_CONFIG_VALUE(GcStressFreqCallsite)    // Number of times to force GC out of GcStressFreqDenom (for GCSTM_RANDOM)
 DEBUG_CONFIG_VALUE(GcStressFreqLoop)        // Number of times to force GC out of GcStressFreqDenom (for GCSTM_RANDOM)
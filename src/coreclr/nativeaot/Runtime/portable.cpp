@@ -67,6 +67,8 @@ FCIMPL1(Object *, RhpNewFast, MethodTable* pEEType)
     ASSERT(alloc_ptr <= combined_limit);
     if ((size_t)(combined_limit - alloc_ptr) >= size)
     {
+        // The GC hands out allocation contexts that are already zeroed, so there is
+        // nothing to clear here besides setting the MethodTable.
         acontext->alloc_ptr = alloc_ptr + size;
         Object* pObject = (Object *)alloc_ptr;
         pObject->set_EEType(pEEType);
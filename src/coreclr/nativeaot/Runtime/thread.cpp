@@ -42,6 +42,7 @@ ee_alloc_context::PerThreadRandom::PerThreadRandom()
 }
 
 thread_local ee_alloc_context::PerThreadRandom ee_alloc_context::t_random = PerThreadRandom();
+uint32_t ee_alloc_context::s_samplingDistributionMean = SamplingDistributionMean;
 
 PInvokeTransitionFrame* Thread::GetTransitionFrame()
 {
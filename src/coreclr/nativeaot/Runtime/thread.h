@@ -24,6 +24,8 @@ class TypeManager;
 // runtime build.
 #define KEEP_THREAD_LAYOUT_CONSTANT
 
+// Room for a gc_alloc_context as of GC_INTERFACE_MAJOR_VERSION 6, which added alloc_quantum_info in what used
+// to be tail padding so the sizes did not change. AsmOffsetsVerify.cpp checks that it still fits.
 #ifndef HOST_64BIT
 # if defined(FEATURE_SVR_GC) || defined(KEEP_THREAD_LAYOUT_CONSTANT)
 #  define SIZEOF_ALLOC_CONTEXT 40
@@ -118,6 +120,9 @@ struct ee_alloc_context
     static bool IsRandomizedSamplingEnabled();
     static uint32_t ComputeGeometricRandom();
 
+    // The mean of the geometric distribution used for sampling, set from DOTNET_AllocationSamplingMean.
+    static uint32_t s_samplingDistributionMean;
+
     struct PerThreadRandom
     {
         minipal_xoshiro128pp random_state;
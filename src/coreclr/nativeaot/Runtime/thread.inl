@@ -57,9 +57,10 @@ inline void ee_alloc_context::UpdateCombinedLimit(bool samplingEnabled)
 inline uint32_t ee_alloc_context::ComputeGeometricRandom()
 {
     // compute a random sample from the Geometric distribution.
+    // Large configured means can push the sample past UINT32_MAX, clamp it before converting.
     double probability = t_random.NextDouble();
-    uint32_t threshold = (uint32_t)(-log(1 - probability) * SamplingDistributionMean);
-    return threshold;
+    double threshold = -log(1 - probability) * s_samplingDistributionMean;
+    return (threshold < (double)UINT32_MAX) ? (uint32_t)threshold : UINT32_MAX;
 }
 
 // Returns a random double in the range [0, 1).
@@ -88,6 +88,12 @@ void CommandLine::DumpHelp(const char* program)
     printf(" -details <file name.csv>\n");
     printf("     Emit detailed information about the replay/diff of each context into the specified file\n");
     printf("\n");
+    printf(" -slowest <N>\n");
+    printf("     At the end of the replay, report the N methods that took the longest to compile with the\n");
+    printf("     first JIT. Methods are ranked by executed instruction count when running under an\n");
+    printf("     instrumentor, and by wall clock time otherwise. In /parallel mode each worker reports\n");
+    printf("     its own methods.\n");
+    printf("\n");
     printf(" -a[pplyDiff]\n");
     printf("     Compare the compile result generated from the provided JIT with the\n");
     printf("     compile result stored with the MC. If two JITs are provided, this\n");
@@ -407,6 +413,23 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
 
                 o->details = argv[i];
             }
+            else if ((_stricmp(&argv[i][1], "slowest") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->slowestCount = atoi(argv[i]);
+
+                if (o->slowestCount < 1)
+                {
+                    LogError("Incorrect count specified for -slowest. Count must be > 0.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_strnicmp(&argv[i][1], "applyDiff", argLen) == 0))
             {
                 o->applyDiff = true;
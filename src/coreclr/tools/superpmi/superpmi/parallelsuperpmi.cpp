@@ -481,6 +481,7 @@ char* ConstructChildProcessArgs(const CommandLine::Options& o)
     ADDARG_STRING(o.compileList, "-compile");
     ADDARG_INT(o.failureLimit, "-failureLimit", -1);
     ADDARG_INT(o.repeatCount, "-repeatCount", 1);
+    ADDARG_INT(o.slowestCount, "-slowest", 0);
 
     addJitOptionArgument(o.forceJitOptions, bytesWritten, spmiArgs, "jitoption force");
     addJitOptionArgument(o.forceJit2Options, bytesWritten, spmiArgs, "jit2option force");
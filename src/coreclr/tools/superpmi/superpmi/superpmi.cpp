@@ -182,6 +182,111 @@ static void PrintDiffsCsvRow(
     fw.Print("\n");
 }
 
+struct SlowMethod
+{
+    int         context;
+    uint64_t    numExecutedInstructions;
+    double      milliseconds;
+    std::string methodFullName;
+};
+
+// Get "Class:Method" for the method compiled by the method context. The JIT only reports its own
+// MethodFullName in DEBUG builds, so this reads the names recorded in the method context instead.
+// Returns an empty string if the names were not recorded.
+static std::string GetSlowMethodName(MethodContext* mc)
+{
+    struct Param : FilterSuperPMIExceptionsParam_CaptureException
+    {
+        MethodContext* mc;
+        char           className[256];
+        char           methodName[256];
+        bool           succeeded;
+    } param;
+    param.mc        = mc;
+    param.succeeded = false;
+
+    PAL_TRY(Param*, pParam, &param)
+    {
+        CORINFO_METHOD_INFO info;
+        unsigned            flags = 0;
+        CORINFO_OS          os;
+        pParam->mc->repCompileMethod(&info, &flags, &os);
+
+        pParam->mc->repPrintClassName(pParam->mc->repGetMethodClass(info.ftn), pParam->className,
+                                      sizeof(pParam->className));
+        pParam->mc->repPrintMethodName(info.ftn, pParam->methodName, sizeof(pParam->methodName));
+        pParam->succeeded = true;
+    }
+    PAL_EXCEPT_FILTER(FilterSuperPMIExceptions_CaptureExceptionAndStop)
+    {
+        SpmiException e(&param);
+        e.DeleteMessage();
+    }
+    PAL_ENDTRY
+
+    if (!param.succeeded)
+    {
+        return "";
+    }
+
+    return std::string(param.className) + ":" + param.methodName;
+}
+
+// Keep the `slowestCount` slowest methods seen so far in `slowest`, ordered from slowest to fastest.
+// Methods are ranked by executed instructions when an instrumentor provides them, else by wall time.
+// A context that is compiled several times (e.g. with -repeatCount) is only kept once, with its slowest time.
+static void RecordSlowMethod(
+    std::vector<SlowMethod>& slowest, int slowestCount, int context, MethodContext* mc, const ReplayResults& res)
+{
+    SlowMethod method;
+    method.context                 = context;
+    method.numExecutedInstructions = res.NumExecutedInstructions;
+    method.milliseconds            = res.CompileResults->secondsToCompile * 1000.0;
+
+    auto isSlower = [](const SlowMethod& a, const SlowMethod& b) {
+        if (a.numExecutedInstructions != b.numExecutedInstructions)
+            return a.numExecutedInstructions > b.numExecutedInstructions;
+        return a.milliseconds > b.milliseconds;
+    };
+
+    for (size_t i = 0; i < slowest.size(); i++)
+    {
+        if (slowest[i].context == context)
+        {
+            if (!isSlower(method, slowest[i]))
+            {
+                return;
+            }
+
+            method.methodFullName = slowest[i].methodFullName;
+            slowest.erase(slowest.begin() + i);
+            break;
+        }
+    }
+
+    if (((int)slowest.size() == slowestCount) && !isSlower(method, slowest.back()))
+    {
+        return;
+    }
+
+    if (method.methodFullName.empty())
+    {
+        method.methodFullName = GetSlowMethodName(mc);
+    }
+
+    size_t pos = 0;
+    while ((pos < slowest.size()) && !isSlower(method, slowest[pos]))
+    {
+        pos++;
+    }
+
+    slowest.insert(slowest.begin() + pos, method);
+    if ((int)slowest.size() > slowestCount)
+    {
+        slowest.pop_back();
+    }
+}
+
 static void PrintReplayCsvHeader(FileWriter& fw)
 {
     fw.Printf("Context,Context size,Method full name,Tier name,Result,MinOpts,Instructions");
@@ -260,6 +365,7 @@ int __cdecl main(int argc, char* argv[])
 
     bool   collectThroughput = false;
     MCList failingToReplayMCL;
+    std::vector<SlowMethod> slowestMethods;
     FileWriter detailsCsv;
 
     CommandLine::Options o;
@@ -478,6 +584,11 @@ int __cdecl main(int argc, char* argv[])
                 {
                     mc->cr->dumpToConsole(); // Dump the compile results if doing debug logging
                 }
+
+                if (o.slowestCount > 0)
+                {
+                    RecordSlowMethod(slowestMethods, o.slowestCount, reader->GetMethodContextIndex(), mc, res);
+                }
             }
             else if (res.Result == ReplayResult::Error)
             {
@@ -795,6 +906,17 @@ doneRepeatCount:
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount, missingCount);
     }
 
+    if (!slowestMethods.empty())
+    {
+        LogInfo("Slowest %d methods:", (int)slowestMethods.size());
+        for (const SlowMethod& method : slowestMethods)
+        {
+            LogInfo("  #%d: %llu instructions, %.3fms, %s", method.context,
+                    (unsigned long long)method.numExecutedInstructions, method.milliseconds,
+                    method.methodFullName.c_str());
+        }
+    }
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
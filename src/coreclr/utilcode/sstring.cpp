@@ -114,6 +114,23 @@ int SString::CaseCompareHelper(const WCHAR *buffer1, const WCHAR *buffer2, COUNT
     const WCHAR *buffer1End = buffer1 + count;
     int diff = 0;
 
+    if (stopOnCount && !stopOnNull)
+    {
+        // Equal characters never affect the result when nulls don't terminate the compare,
+        // so skip the common prefix a UINT64 at a time before falling back to the per-character loop.
+        const COUNT_T charsPerChunk = sizeof(UINT64) / sizeof(WCHAR);
+        while ((COUNT_T)(buffer1End - buffer1) >= charsPerChunk)
+        {
+            UINT64 chunk1, chunk2;
+            memcpy(&chunk1, buffer1, sizeof(chunk1));
+            memcpy(&chunk2, buffer2, sizeof(chunk2));
+            if (chunk1 != chunk2)
+                break;
+            buffer1 += charsPerChunk;
+            buffer2 += charsPerChunk;
+        }
+    }
+
     while (!stopOnCount || (buffer1 < buffer1End))
     {
         WCHAR ch1 = *buffer1++;
@@ -157,6 +174,21 @@ int SString::CaseCompareHelperA(const CHAR *buffer1, const CHAR *buffer2, COUNT_
     const CHAR *buffer1End = buffer1 + count;
     int diff = 0;
 
+    if (stopOnCount && !stopOnNull)
+    {
+        // See CaseCompareHelper.
+        while ((COUNT_T)(buffer1End - buffer1) >= sizeof(UINT64))
+        {
+            UINT64 chunk1, chunk2;
+            memcpy(&chunk1, buffer1, sizeof(chunk1));
+            memcpy(&chunk2, buffer2, sizeof(chunk2));
+            if (chunk1 != chunk2)
+                break;
+            buffer1 += sizeof(UINT64);
+            buffer2 += sizeof(UINT64);
+        }
+    }
+
     while (!stopOnCount || (buffer1 < buffer1End))
     {
         CHAR ch1 = *buffer1;
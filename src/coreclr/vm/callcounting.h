@@ -58,6 +58,11 @@ Miscellaneous
   a fair bit of additional overhead to stop counting. On the other hand, it may at times be beneficial to rejit some methods
   during startup. So for now, only newly called methods during the current tiering delay would not be counted, any that already
   started counting will continue (their delay already expired).
+- Deleting call counting stubs is the only part of call counting that suspends the runtime, and it is off by default
+  (TC_DeleteCallCountingStubsAfter is 0), so by default completed stubs are left in place instead of being reclaimed.
+  TC_UseCallCountingStubs=0 counts calls in the prestub instead and allocates no stubs, at the cost of a slower counting
+  path. Counting in the tier 0 prolog itself would need a JIT-emitted counter cell and threshold helper; without those,
+  entry point transitions would still go through the code versioning machinery here.
 
 *******************************************************************************************************************************/
 
@@ -12,6 +12,7 @@
 BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
+DWORD CastCache::s_maximumCacheSize  = MAXIMUM_CACHE_SIZE;
 const DWORD CastCache::INITIAL_CACHE_SIZE;
 
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
@@ -119,6 +120,13 @@ void CastCache::Initialize()
     }
     CONTRACTL_END;
 
+    DWORD maximumCacheSize = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_CastCacheMaximumSize);
+    if (maximumCacheSize != 0)
+    {
+        // keep the limit a power of two, and within what the version bits and the index math can address
+        s_maximumCacheSize = RoundUpToPower2(min(max(maximumCacheSize, INITIAL_CACHE_SIZE), (DWORD)(1 << 20)));
+    }
+
     FieldDesc* pTableField = CoreLibBinder::GetField(FIELD__CASTCACHE__TABLE);
 
     GCX_COOP();
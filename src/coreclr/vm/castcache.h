@@ -176,6 +176,8 @@ private:
 // Considering that typically the cache size is small and that hit rates are high with good locality,
 // just keeping the cache around seems a simple and viable strategy.
 //
+// Apps with a very large number of distinct type pairs can raise the limit with DOTNET_CastCacheMaximumSize.
+//
 // Additional behaviors that could be considered, if there are scenarios that could be improved:
 //     - flush the cache based on some heuristics
 //     - shrink the cache based on some heuristics
@@ -206,6 +208,9 @@ private:
 
     static DWORD          s_lastFlushSize;
 
+    // largest size TryGrow may reach, MAXIMUM_CACHE_SIZE unless overridden by config
+    static DWORD          s_maximumCacheSize;
+
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
         CONTRACTL
@@ -251,7 +256,7 @@ private:
         CONTRACTL_END;
 
         DWORD newSize = CacheElementCount(tableData) * 2;
-        if (newSize <= MAXIMUM_CACHE_SIZE)
+        if (newSize <= s_maximumCacheSize)
         {
             return MaybeReplaceCacheWithLarger(newSize);
         }
@@ -457,7 +457,14 @@ void Module::Initialize(AllocMemTracker *pamTracker, LPCWSTR szName)
 #endif
 
     // Initialize the instance fields that we need for all Modules
-    if (m_pAvailableClasses == NULL && !IsReadyToRun())
+
+    // With LazyAvailableClassHash set, the available class hash of an IL image is populated on the first by-name
+    // type lookup in the module (see ClassLoader::LazyPopulateCaseSensitiveHashTables), since many modules are only
+    // ever accessed through tokens. It is off by default because the DAC cannot populate the table, so by-name
+    // lookups from the debugger miss until the runtime has built it. Reflection emit modules start out empty and
+    // have types added as they are defined, so they always need it up front.
+    if (m_pAvailableClasses == NULL && !IsReadyToRun() &&
+        (IsReflectionEmit() || !CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_LazyAvailableClassHash)))
     {
         m_pAvailableClasses = EEClassHashTable::Create(this,
             GetAssembly()->IsCollectible() ? AVAILABLE_CLASSES_HASH_BUCKETS_COLLECTIBLE : AVAILABLE_CLASSES_HASH_BUCKETS,
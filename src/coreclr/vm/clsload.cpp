@@ -532,17 +532,18 @@ void ClassLoader::GetClassValue(NameHandleTable nhTable,
             {
                 *ppTable = pTable = pCurrentClsModule->GetAvailableClassHash();
 
-#ifdef FEATURE_READYTORUN
-                if (pTable == NULL && pCurrentClsModule->IsReadyToRun() && !pCurrentClsModule->GetReadyToRunInfo()->HasHashtableOfTypes())
+                if (pTable == NULL)
                 {
-                    // Old R2R image generated without the hashtable of types.
-                    // We fallback to the slow path of creating the hashtable dynamically
+                    // IL image whose hashtable has not been populated yet, or an old R2R image generated without
+                    // the hashtable of types. We fallback to the slow path of creating the hashtable dynamically
                     // at execution time in that scenario. The caller will handle
+#ifdef FEATURE_READYTORUN
+                    _ASSERTE(!pCurrentClsModule->IsReadyToRun() || !pCurrentClsModule->GetReadyToRunInfo()->HasHashtableOfTypes());
+#endif
                     pFoundEntry->SetClassHashBasedEntryValue(NULL);
                     needsToBuildHashtable = TRUE;
                     return;
                 }
-#endif
             }
             else
             {
@@ -670,11 +671,14 @@ void ClassLoader::LazyPopulateCaseSensitiveHashTables()
     Module *pModule = GetAssembly()->GetModule();
     if (pModule->GetAvailableClassHash() == NULL)
     {
-        // Lazy construction of the case-sensitive hashtable of types is *only* a scenario for ReadyToRun images
-        // (either images compiled with an old version of crossgen, or for case-insensitive type lookups in R2R modules)
-        _ASSERT(pModule->IsReadyToRun());
+        // Lazy construction of the case-sensitive hashtable of types happens for ReadyToRun images (either images
+        // compiled with an old version of crossgen, or for case-insensitive type lookups in R2R modules) and for IL
+        // images, whose hashtable is only built on the first by-name lookup (see Module::Initialize)
+        _ASSERT(!pModule->IsReflectionEmit());
 
-        EEClassHashTable * pNewClassHash = EEClassHashTable::Create(pModule, AVAILABLE_CLASSES_HASH_BUCKETS, NULL, &amTracker);
+        EEClassHashTable * pNewClassHash = EEClassHashTable::Create(pModule,
+            GetAssembly()->IsCollectible() ? AVAILABLE_CLASSES_HASH_BUCKETS_COLLECTIBLE : AVAILABLE_CLASSES_HASH_BUCKETS,
+            NULL, &amTracker);
         pModule->SetAvailableClassHash(pNewClassHash);
 
         PopulateAvailableClassHashTable(pModule, &amTracker);
@@ -1030,7 +1034,7 @@ BOOL ClassLoader::FindClassModuleThrowing(
             }
             else
             {
-                // Note: This codepath is only valid for R2R scenarios
+                // Note: This codepath is only valid for R2R scenarios and IL images whose hashtable is built lazily
                 LazyPopulateCaseSensitiveHashTables();
             }
 
@@ -2769,10 +2773,16 @@ TypeHandle ClassLoader::PublishType(const TypeKey *pTypeKey, TypeHandle typeHnd)
         Module *pLoaderModule = ComputeLoaderModule(pTypeKey);
         EETypeHashTable *pTable = pLoaderModule->GetAvailableParamTypes();
 
+        // The type could have been loaded by a different thread as side-effect of avoiding deadlocks caused by LoadsTypeViolation.
+        // Lookups in the table are safe without the lock, so check first to keep threads that lost the race
+        // off the loader-wide lock.
+        TypeHandle existing = pTable->GetValue(pTypeKey);
+        if (!existing.IsNull())
+            return existing;
+
         CrstHolder ch(&pLoaderModule->GetClassLoader()->m_AvailableTypesLock);
 
-        // The type could have been loaded by a different thread as side-effect of avoiding deadlocks caused by LoadsTypeViolation
-        TypeHandle existing = pTable->GetValue(pTypeKey);
+        existing = pTable->GetValue(pTypeKey);
         if (!existing.IsNull())
             return existing;
 
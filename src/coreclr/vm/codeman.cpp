@@ -1376,6 +1376,12 @@ void EEJitManager::SetCpuInfo()
 
         // For now, enable SVE only when the system vector length is 16 bytes (128-bits)
         // TODO: https://github.com/dotnet/runtime/issues/101477
+        //
+        // Letting Vector<T> track a wider hardware vector length additionally requires:
+        // * the PAL context capture/restore to save Z/P registers longer than 16 bytes,
+        // * the type loader to size Vector<T> from the SVE length rather than VectorT128, and
+        // * the JIT to lower Vector<T> operations to predicated SVE instructions.
+        // Until all of these exist, SVE stays disabled on wider hardware rather than mixing lengths.
         if (sveLengthFromOS == 16)
         // if ((maxVectorTLength >= sveLengthFromOS) || (maxVectorTBitWidth == 0))
         {
@@ -4663,8 +4669,38 @@ PTR_RUNTIME_FUNCTION EEJitManager::LazyGetFunctionEntry(EECodeInfo * pCodeInfo)
     // Thus, save it off right now.
     TADDR baseAddress = pCodeInfo->GetModuleBase();
 
-    // NOTE: We could binary search here, if it would be helpful (e.g., large number of funclets)
-    for (UINT iUnwindInfo = 0; iUnwindInfo < pHeader->GetNumberOfUnwindInfos(); iUnwindInfo++)
+    UINT nUnwindInfos = pHeader->GetNumberOfUnwindInfos();
+
+    // Methods with many funclets (e.g. many nested try regions) are searched by address first. Unwind infos are ordered
+    // by address unless the method has cold code, whose unwind infos are interleaved with those of the hot parts, so a
+    // miss falls back to the linear search below. Unwind infos never overlap, so any one containing the address is the
+    // right one.
+    const UINT MinUnwindInfosForBinarySearch = 8;
+    if (nUnwindInfos >= MinUnwindInfosForBinarySearch)
+    {
+        UINT low = 0;
+        UINT high = nUnwindInfos;
+        while (low < high)
+        {
+            UINT mid = low + (high - low) / 2;
+            PTR_RUNTIME_FUNCTION pFunctionEntry = pHeader->GetUnwindInfo(mid);
+
+            if (address < RUNTIME_FUNCTION__BeginAddress(pFunctionEntry))
+            {
+                high = mid;
+            }
+            else if (address >= RUNTIME_FUNCTION__EndAddress(pFunctionEntry, baseAddress))
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                return pFunctionEntry;
+            }
+        }
+    }
+
+    for (UINT iUnwindInfo = 0; iUnwindInfo < nUnwindInfos; iUnwindInfo++)
     {
         PTR_RUNTIME_FUNCTION pFunctionEntry = pHeader->GetUnwindInfo(iUnwindInfo);
 
@@ -821,6 +821,11 @@ enum class RangeSectionLockState
 //
 // Reading this code you will ALSO find that the ReaderLock logic used here is intertwined with the GC mode of the process. In particular,
 // in cooperative mode and during GC stackwalking, the ReaderLock is always considered to be held.
+//
+// An IP->method lookup is thus a fixed number of loads through this tree followed by the nibble map lookup in
+// EECodeGenManager::FindMethodCode, which reads at most two DWORDs of the map since code start pointers are encoded
+// directly in the map for any DWORD that a method body fully covers. Only lookups that reach collectible data from a
+// preemptive-mode thread (e.g. a sampling profiler) take the Reader lock.
 class RangeSectionMap
 {
     class RangeSectionFragment;
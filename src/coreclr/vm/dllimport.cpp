@@ -4061,6 +4061,10 @@ namespace
         //
         // Build hash blob for IL stub sharing
         //
+        // The blob does not include the module (m_pModule is left NULL below) and the signature has been converted to its
+        // internal, module-independent form, so stubs are shared by every method with the same normalized signature and
+        // marshaling metadata whose loader module uses the same LoaderAllocator's ILStubCache (see Module::GetILStubCache).
+        //
         S_SIZE_T cbSizeOfBlob = S_SIZE_T(offsetof(NDirectStubHashBlob, m_rgbSigAndParamData)) +
                                 S_SIZE_T(sizeof(ULONG)) * S_SIZE_T(pParams->m_nParamTokens) +   // Parameter attributes
                                 S_SIZE_T(sizeof(DWORD)) * S_SIZE_T(pParams->m_nParamTokens) +   // Native type blob size
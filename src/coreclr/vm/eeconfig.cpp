@@ -208,6 +208,7 @@ HRESULT EEConfig::Init()
     fTieredCompilation_UseCallCountingStubs = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
     tieredCompilation_CallCountingDelayMs = 0;
     tieredCompilation_DeleteCallCountingStubsAfter = 0;
 #endif
@@ -650,6 +651,16 @@ HRESULT EEConfig::sync()
         tieredCompilation_BackgroundWorkerTimeoutMs =
             CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerTimeoutMs);
 
+        tieredCompilation_BackgroundWorkerCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TC_BackgroundWorkerCount);
+        if (tieredCompilation_BackgroundWorkerCount == 0)
+        {
+            tieredCompilation_BackgroundWorkerCount = 1;
+        }
+        else if (tieredCompilation_BackgroundWorkerCount > (DWORD)GetCurrentProcessCpuCount())
+        {
+            tieredCompilation_BackgroundWorkerCount = (DWORD)GetCurrentProcessCpuCount();
+        }
+
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
         DWORD tieredCompilation_ConfiguredCallCountThreshold =
@@ -671,8 +682,10 @@ HRESULT EEConfig::sync()
         tieredCompilation_CallCountingDelayMs =
             Configuration::GetKnobDWORDValue(W("System.Runtime.TieredCompilation.CallCountingDelayMs"), CLRConfig::EXTERNAL_TC_CallCountingDelayMs);
 
-        bool hasSingleProcessor = GetCurrentProcessCpuCount() == 1;
-        if (hasSingleProcessor)
+        // The processor count accounts for affinity and for a CPU quota limit (such as in a container), so in a CPU-limited
+        // environment the delay is extended to keep background jitting from competing with the app's threads during warmup
+        DWORD delayMaxProcessorCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_DelayMultiplierMaxProcCount);
+        if ((DWORD)GetCurrentProcessCpuCount() <= max(delayMaxProcessorCount, (DWORD)1))
         {
             DWORD delayMultiplier = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_DelaySingleProcMultiplier);
             if (delayMultiplier > 1)
@@ -721,6 +734,23 @@ HRESULT EEConfig::sync()
             tieredPGO_ScalableCountThreshold = scalableCountThreshold;
         }
 
+        if ((CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredPGO_ScaleCountThresholdWithProcessors) != 0) &&
+            !CLRConfig::IsConfigOptionSpecified(W("TieredPGO_ScalableCountThreshold")))
+        {
+            // Counts below the threshold are updated with an interlocked add on every execution, and on machines with many
+            // processors those shared counters become a scalability bottleneck while hot methods are warming up. Switch to
+            // approximate counting earlier as the processor count grows, halving the exact range for each doubling above 8
+            // processors, down to 2^8 exact counts. Past the threshold each update adds a larger increment with a lower
+            // probability, so counts get coarser, which is why this is opt-in.
+            const DWORD minScalableCountThreshold = 8;
+            for (int processorCount = GetCurrentProcessCpuCount();
+                 (processorCount > 8) && (tieredPGO_ScalableCountThreshold > minScalableCountThreshold);
+                 processorCount /= 2)
+            {
+                tieredPGO_ScalableCountThreshold--;
+            }
+        }
+
         // We need quick jit for TieredPGO
         if (!fTieredCompilation_QuickJit)
         {
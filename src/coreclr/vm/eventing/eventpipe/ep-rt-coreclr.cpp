@@ -148,7 +148,10 @@ ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (
 	if (ThreadSuspend::SysIsSuspendInProgress () || (ThreadSuspend::GetSuspensionThread () != 0))
 		return;
 
-	// Actually suspend managed execution.
+	// Actually suspend managed execution. The managed stack walker is not async-signal-safe and
+	// needs every walked thread stopped at a point where its frames are consistent, so sampling
+	// threads individually from a signal handler is not an option here. Threads in preemptive mode
+	// are not stopped by the suspension; they are walked from their last transition frame.
 	ThreadSuspend::SuspendEE (ThreadSuspend::SUSPEND_REASON::SUSPEND_OTHER);
 
 	// Walk all managed threads and capture stacks.
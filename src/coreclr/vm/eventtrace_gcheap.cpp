@@ -579,6 +579,25 @@ public:
         ClearRootConditionalWeakTableElementEdges();
         ClearNodes();
         ClearEdges();
+        ZeroMemory(rgRecentlyLoggedTypeIDs, sizeof(rgRecentlyLoggedTypeIDs));
+    }
+
+    // Returns TRUE if typeID was already handed to the type logger during this heap
+    // dump (as far as the cache remembers), and remembers it otherwise. Heaps tend to
+    // contain long runs of objects of the same few types, so this lets ObjectReference
+    // skip the lock and hash lookup of LogTypeAndParametersIfNecessary for most nodes
+    // while the runtime is suspended for the walk.
+    BOOL CheckAndRememberLoggedType(ULONGLONG typeID)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Type IDs are MethodTable pointers, so the low bits carry no information
+        ULONGLONG* pEntry = &rgRecentlyLoggedTypeIDs[(typeID >> 3) % ARRAY_SIZE(rgRecentlyLoggedTypeIDs)];
+        if (*pEntry == typeID)
+            return TRUE;
+
+        *pEntry = typeID;
+        return FALSE;
     }
 
     // These helpers clear the individual buffers, for use after a flush and on
@@ -710,6 +729,10 @@ public:
     //---------------------------------------------------------------------------------------
 
     BulkTypeEventLogger bulkTypeEventLogger;
+
+    // Direct mapped cache of type IDs already passed to bulkTypeEventLogger, see
+    // CheckAndRememberLoggedType
+    ULONGLONG rgRecentlyLoggedTypeIDs[256];
 };
 
 
@@ -903,7 +926,7 @@ VOID ETW::GCLog::ObjectReference(
 
     // We send type information as necessary--only for nodes, and only for nodes that we
     // haven't already sent type info for
-    if (typeID != 0)
+    if ((typeID != 0) && !pContext->CheckAndRememberLoggedType(typeID))
     {
         ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(
             &pContext->bulkTypeEventLogger,     // Batch up this type with others to minimize events
@@ -44,6 +44,7 @@ bool g_sw_ww_enabled_for_gc_heap = false;
 GVAL_IMPL_INIT(ee_alloc_context, g_global_alloc_context, {});
 
 thread_local ee_alloc_context::PerThreadRandom ee_alloc_context::t_random = PerThreadRandom();
+DWORD ee_alloc_context::s_samplingDistributionMean = SamplingDistributionMean;
 
 enum GC_LOAD_STATUS {
     GC_LOAD_STATUS_BEFORE_START,
@@ -379,6 +380,10 @@ HRESULT GCHeapUtilities::LoadAndInitialize()
     s_useThreadAllocationContexts = true;
 #endif
 
+    // A mean of 0 would sample every allocation, which is what a mean of 1 already does.
+    DWORD samplingMean = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_AllocationSamplingMean);
+    ee_alloc_context::s_samplingDistributionMean = max(samplingMean, (DWORD)1);
+
     // we should only call this once on startup. Attempting to load a GC
     // twice is an error.
     assert(g_pGCHeap == nullptr);
@@ -16,6 +16,8 @@ GPTR_DECL(IGCHeap, g_pGCHeap);
 extern "C" {
 #endif // !DACCESS_COMPILE
 
+// Default mean of the number of bytes allocated between two allocation samples,
+// can be changed with DOTNET_AllocationSamplingMean.
 const DWORD SamplingDistributionMean = (100 * 1024);
 
 // This struct allows adding some state that is only visible to the EE onto the standard gc_alloc_context
@@ -111,11 +113,15 @@ struct ee_alloc_context
     static inline uint32_t ComputeGeometricRandom()
     {
         // compute a random sample from the Geometric distribution.
+        // Large configured means can push the sample past UINT32_MAX, clamp it before converting.
         double probability = t_random.NextDouble();
-        uint32_t threshold = (uint32_t)(-log(1 - probability) * SamplingDistributionMean);
-        return threshold;
+        double threshold = -log(1 - probability) * s_samplingDistributionMean;
+        return (threshold < (double)UINT32_MAX) ? (uint32_t)threshold : UINT32_MAX;
     }
 
+    // The mean of the geometric distribution above, the sampling overhead is inversely proportional to it.
+    static DWORD s_samplingDistributionMean;
+
     struct PerThreadRandom
     {
         minipal_xoshiro128pp random_state;
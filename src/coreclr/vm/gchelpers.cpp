@@ -356,7 +356,8 @@ void FireAllocationSampled(GC_ALLOC_FLAGS flags, size_t size, size_t samplingBud
             (flags & GC_ALLOC_PINNED_OBJECT_HEAP) ? 2 :
             (flags & GC_ALLOC_LARGE_OBJECT_HEAP) ? 1 :
             0;  // SOH
-        FireEtwAllocationSampled(allocKind, GetClrInstanceId(), typeId, name, (BYTE*)orObject, size, samplingBudgetOffset);
+        FireEtwAllocationSampled_V1(allocKind, GetClrInstanceId(), typeId, name, (BYTE*)orObject, size, samplingBudgetOffset,
+            ee_alloc_context::s_samplingDistributionMean);
     }
 #endif //FEATURE_EVENT_TRACE
 }
@@ -1484,7 +1485,7 @@ extern "C" HCIMPL2_RAW(VOID, JIT_CheckedWriteBarrier, Object **dst, Object *ref)
         CheckedDestInEphem++;
     }
 #endif
-    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high)
+    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high && InlinedRegionStoreNeedsCardHelper(dst, ref))
     {
 #ifdef FEATURE_COUNT_GC_WRITE_BARRIERS
         CheckedAfterRefInEphemFilter++;
@@ -1544,7 +1545,7 @@ extern "C" HCIMPL2_RAW(VOID, JIT_WriteBarrier, Object **dst, Object *ref)
         UncheckedDestInEphem++;
     }
 #endif
-    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high)
+    if((BYTE*) ref >= g_ephemeral_low && (BYTE*) ref < g_ephemeral_high && InlinedRegionStoreNeedsCardHelper(dst, ref))
     {
 #ifdef FEATURE_COUNT_GC_WRITE_BARRIERS
         UncheckedAfterRefInEphemFilter++;
@@ -1610,7 +1611,8 @@ void ErectWriteBarrier(OBJECTREF *dst, OBJECTREF ref)
     }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
-    if ((BYTE*) OBJECTREFToObject(ref) >= g_ephemeral_low && (BYTE*) OBJECTREFToObject(ref) < g_ephemeral_high)
+    if ((BYTE*) OBJECTREFToObject(ref) >= g_ephemeral_low && (BYTE*) OBJECTREFToObject(ref) < g_ephemeral_high &&
+        InlinedRegionStoreNeedsCardHelper(dst, OBJECTREFToObject(ref)))
     {
         // VolatileLoadWithoutBarrier() is used here to prevent fetch of g_card_table from being reordered
         // with g_lowest/highest_address check above. See comment in StompWriteBarrier.
@@ -29,6 +29,22 @@
     #endif
 #endif
 
+// With regions the ephemeral range is only a coarse filter - it may span gen2 regions, and a
+// reference stored into a gen0 region or between two regions of the same generation never needs
+// a card. This applies the same check as the region aware JIT write barriers to a store of ref
+// into dst, both of which are already known to be in the heap.
+FORCEINLINE bool InlinedRegionStoreNeedsCardHelper(void* dst, void* ref)
+{
+    uint8_t regionShr = g_region_shr;
+    if (regionShr == 0)
+    {
+        return true;
+    }
+
+    uint8_t* regionToGeneration = VolatileLoadWithoutBarrier(&g_region_to_generation_table);
+    return regionToGeneration[(size_t)ref >> regionShr] < regionToGeneration[(size_t)dst >> regionShr];
+}
+
 FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
 {
     // Caller is expected to check whether the writes were even into the heap
@@ -59,46 +75,66 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
     size_t startingClump = startAddress >> card_byte_shift;
     size_t endingClump = (endAddress + (1 << card_byte_shift) - 1) >> card_byte_shift;
 
-    // calculate the number of clumps to mark (round_up(end) - start)
-    size_t clumpCount = endingClump - startingClump;
-
     // VolatileLoadWithoutBarrier() is used here to prevent fetch of g_card_table from being reordered
     // with g_lowest/highest_address check above. See comment in StompWriteBarrier.
-    BYTE* card = (BYTE*)VolatileLoadWithoutBarrier(&g_card_table) + startingClump;
+    BYTE* cardTable = (BYTE*)VolatileLoadWithoutBarrier(&g_card_table);
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+    uint8_t* bundleTable = (uint8_t*)VolatileLoadWithoutBarrier(&g_card_bundle_table);
+#endif
 
-    // Fill the cards. To avoid cache line thrashing we check whether the cards have already been set before
-    // writing.
-    do
+    BYTE* ephemeralLow = g_ephemeral_low;
+    BYTE* ephemeralHigh = g_ephemeral_high;
+    uint8_t regionShr = g_region_shr;
+    uint8_t* regionToGeneration = VolatileLoadWithoutBarrier(&g_region_to_generation_table);
+
+    // Like the precise write barrier, only mark the cards that cover at least one reference into the
+    // ephemeral range - a card set for a range holding only gen2 references (e.g. an array of strings
+    // copied around in gen2) would otherwise have to be scanned by every ephemeral GC. Within a card we
+    // stop looking at references as soon as one of them needs the card. With regions a card never
+    // spans two regions, so the generation of the destination is looked up once per card and cards
+    // in gen0 regions are skipped entirely (see InlinedRegionStoreNeedsCardHelper). To avoid cache
+    // line thrashing we check whether the cards have already been set before writing.
+    Object** ref = start;
+    for (size_t clump = startingClump; clump < endingClump; clump++)
     {
-        if (*card != 0xff)
+        Object** clumpEnd = (Object**)min ((clump + 1) << card_byte_shift, endAddress);
+        BYTE* card = cardTable + clump;
+
+        if (*card == 0xff)
         {
-            *card = 0xff;
+            ref = clumpEnd;
+            continue;
         }
 
-        card++;
-        clumpCount--;
-    }
-    while (clumpCount != 0);
-
-#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
-    size_t startBundleByte = startAddress >> card_bundle_byte_shift;
-    size_t endBundleByte = (endAddress + (1 << card_bundle_byte_shift) - 1) >> card_bundle_byte_shift;
-    size_t bundleByteCount = endBundleByte - startBundleByte;
-
-    uint8_t* pBundleByte = ((uint8_t*)VolatileLoadWithoutBarrier(&g_card_bundle_table)) + startBundleByte;
-
-    do
-    {
-        if (*pBundleByte != 0xFF)
+        uint8_t destGeneration = (regionShr != 0) ? regionToGeneration[(size_t)ref >> regionShr] : UINT8_MAX;
+        if (destGeneration == 0)
         {
-            *pBundleByte = 0xFF;
+            ref = clumpEnd;
+            continue;
         }
 
-        pBundleByte++;
-        bundleByteCount--;
-    }
-    while (bundleByteCount != 0);
+        for (; ref < clumpEnd; ref++)
+        {
+            BYTE* value = (BYTE*)VolatileLoadWithoutBarrier(ref);
+            if ((value >= ephemeralLow) && (value < ephemeralHigh) &&
+                ((regionShr == 0) || (regionToGeneration[(size_t)value >> regionShr] < destGeneration)))
+            {
+                *card = 0xff;
+
+#ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
+                uint8_t* pBundleByte = bundleTable + (clump >> (card_bundle_byte_shift - card_byte_shift));
+                if (*pBundleByte != 0xFF)
+                {
+                    *pBundleByte = 0xFF;
+                }
 #endif
+                ref = clumpEnd;
+                break;
+            }
+        }
+    }
+
+    _ASSERTE(ref == (Object**)endAddress);
 }
 
 #endif // !_GCHELPERS_INL_
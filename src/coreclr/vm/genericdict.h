@@ -84,6 +84,11 @@ class DictionaryLayout;
 typedef DPTR(DictionaryLayout) PTR_DictionaryLayout;
 
 // Number of slots to initially allocate in a generic method dictionary layout.
+//
+// Instantiations created after a layout has grown are allocated at the layout's current size, so only
+// instantiations that already existed pay for an expansion (see Dictionary::GetMethodDictionaryWithSizeCheck).
+// Expansion takes the dictionary expansion lock once per dictionary; lookups of slots that are within the
+// published size never take it.
 #if _DEBUG
 #define NUM_DICTIONARY_SLOTS 1  // Smaller number to stress the dictionary expansion logic
 #else
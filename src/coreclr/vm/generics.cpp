@@ -154,6 +154,10 @@ TypeHandle ClassLoader::LoadCanonicalGenericInstantiation(const TypeKey *pTypeKe
 // Create a non-canonical instantiation of a generic type, by
 // copying the method table of the canonical instantiation
 //
+// MethodTableBuilder only runs for the canonical instantiation. Instantiations over reference types
+// share its vtable chunks and EEClass, and their dictionary slots are filled lazily on first use, so
+// the per-instantiation cost here is mostly the MethodTable itself, its interface map and dictionary.
+//
 /* static */
 TypeHandle
 ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
@@ -1915,7 +1915,9 @@ CALL_INTERP_METHOD:
                     // Save current execution state for when we return from called method
                     pFrame->ip = ip;
 
-                    // Allocate child frame.
+                    // Allocate child frame. The callee's stack starts at the caller's call args
+                    // offset, so arguments are already in place and never copied between frames.
+                    // Context frames are kept on the pNext chain and reused by later calls.
                     {
                         InterpMethodContextFrame *pChildFrame = pFrame->pNext;
                         if (!pChildFrame)
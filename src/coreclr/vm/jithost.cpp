@@ -91,12 +91,96 @@ void JitHost::freeStringConfigValue(const char* value)
 //
 // - Keep up to some limit worth of memory, with loose affinization of memory blocks to threads.
 // - On finalizer thread, release the extra memory that was not used recently.
+// - Additionally keep one small block per thread, so that back-to-back compilations of small methods
+//   on the same thread (e.g. the tiering background worker) do not need to take the lock at all.
+//   A thread reserves MaxThreadCachedSlabSize of the limit for its block, and gives it back on thread exit
+//   or when the finalizer thread finds that the block was not used recently.
 //
 
+// Do not retain blocks larger than this in the per-thread slot
+static const size_t MaxThreadCachedSlabSize = 0x20000;
+
+// Marks a per-thread slot that is not registered with the JitHost and must not hold a block
+#define UNREGISTERED_THREAD_SLAB ((Slab*)(size_t)1)
+
+thread_local JitHost::ThreadSlabCache JitHost::t_threadSlabCache;
+
+JitHost::ThreadSlabCache::ThreadSlabCache() :
+    pSlab(UNREGISTERED_THREAD_SLAB),
+    fRecentlyUsed(false),
+    pNext(NULL)
+{
+}
+
+JitHost::ThreadSlabCache::~ThreadSlabCache()
+{
+    if (pSlab != UNREGISTERED_THREAD_SLAB)
+    {
+        CrstHolder lock(&s_theJitHost.m_jitSlabAllocatorCrst);
+
+        // reclaim may have unregistered the slot since the check above
+        if (pSlab != UNREGISTERED_THREAD_SLAB)
+            s_theJitHost.unregisterThreadSlabCache_Locked(this);
+    }
+}
+
+// Registers the slot if the cache limit allows for another block, counting that block against the limit.
+bool JitHost::registerThreadSlabCache(ThreadSlabCache* pCache)
+{
+    CrstHolder lock(&m_jitSlabAllocatorCrst);
+
+    if (m_totalCached + MaxThreadCachedSlabSize > g_pConfig->JitHostMaxSlabCache())
+        return false;
+
+    m_totalCached += MaxThreadCachedSlabSize;
+    pCache->pNext = m_pThreadSlabCaches;
+    m_pThreadSlabCaches = pCache;
+    InterlockedExchangeT(&pCache->pSlab, (Slab*)NULL);
+    return true;
+}
+
+// Frees the block in the slot, if any, and gives its share of the cache limit back.
+void JitHost::unregisterThreadSlabCache_Locked(ThreadSlabCache* pCache)
+{
+    _ASSERTE(m_jitSlabAllocatorCrst.OwnedByCurrentThread());
+
+    Slab* p = InterlockedExchangeT(&pCache->pSlab, UNREGISTERED_THREAD_SLAB);
+    _ASSERTE(p != UNREGISTERED_THREAD_SLAB);
+    delete [] (BYTE*)p;
+
+    m_totalCached -= MaxThreadCachedSlabSize;
+
+    for (ThreadSlabCache** ppCache = &m_pThreadSlabCaches; *ppCache != NULL; ppCache = &(*ppCache)->pNext)
+    {
+        if (*ppCache == pCache)
+        {
+            *ppCache = pCache->pNext;
+            break;
+        }
+    }
+}
+
 void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
 {
     size = max(size, sizeof(Slab));
 
+    ThreadSlabCache& threadCache = t_threadSlabCache;
+    Slab* pThreadSlab = threadCache.pSlab;
+    if (pThreadSlab != NULL && pThreadSlab != UNREGISTERED_THREAD_SLAB &&
+        InterlockedCompareExchangeT(&threadCache.pSlab, (Slab*)NULL, pThreadSlab) == pThreadSlab)
+    {
+        if (pThreadSlab->size >= size && pThreadSlab->size <= 4 * size)
+        {
+            threadCache.fRecentlyUsed = true;
+            *pActualSize = pThreadSlab->size;
+            return pThreadSlab;
+        }
+
+        // Not a good fit, keep it in the slot unless reclaim unregistered the slot in the meantime.
+        if (InterlockedCompareExchangeT(&threadCache.pSlab, pThreadSlab, (Slab*)NULL) != NULL)
+            delete [] (BYTE*)pThreadSlab;
+    }
+
     Thread* pCurrentThread = GetThreadNULLOk();
     if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
     {
@@ -148,6 +232,19 @@ void JitHost::freeSlab(void* slab, size_t actualSize)
 {
     _ASSERTE(actualSize >= sizeof(Slab));
 
+    ThreadSlabCache& threadCache = t_threadSlabCache;
+    if (actualSize <= MaxThreadCachedSlabSize &&
+        (threadCache.pSlab == NULL || (threadCache.pSlab == UNREGISTERED_THREAD_SLAB && registerThreadSlabCache(&threadCache))))
+    {
+        Slab* pSlab = (Slab*)slab;
+        pSlab->size = actualSize;
+        threadCache.fRecentlyUsed = true;
+
+        // Fails if reclaim unregistered the slot in the meantime.
+        if (InterlockedCompareExchangeT(&threadCache.pSlab, pSlab, (Slab*)NULL) == NULL)
+            return;
+    }
+
     if (actualSize < 0x100000) // Do not cache blocks that are more than 1MB
     {
         CrstHolder lock(&m_jitSlabAllocatorCrst);
@@ -175,7 +272,7 @@ void JitHost::init()
 
 void JitHost::reclaim()
 {
-    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
+    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL || m_pThreadSlabCaches != NULL)
     {
         DWORD ticks = (DWORD)minipal_lowres_ticks();
 
@@ -209,6 +306,26 @@ void JitHost::reclaim()
 
             delete [] (BYTE*)slabToDelete;
         }
+
+        // Release the per-thread slots that were not used since the last flush
+        {
+            CrstHolder lock(&m_jitSlabAllocatorCrst);
+
+            ThreadSlabCache* pCache = m_pThreadSlabCaches;
+            while (pCache != NULL)
+            {
+                ThreadSlabCache* pNext = pCache->pNext;
+                if (pCache->fRecentlyUsed)
+                {
+                    pCache->fRecentlyUsed = false;
+                }
+                else
+                {
+                    unregisterThreadSlabCache_Locked(pCache);
+                }
+                pCache = pNext;
+            }
+        }
     }
 }
 
@@ -17,9 +17,26 @@ private:
         Thread* affinity;
     };
 
+    // One block kept per thread, see allocateSlab. While a slot is registered, MaxThreadCachedSlabSize
+    // is counted in m_totalCached on its behalf, and reclaim releases slots that were not used recently.
+    struct ThreadSlabCache
+    {
+        // A cached Slab, NULL when empty, or Unregistered. Only the owning thread stores a block here,
+        // but reclaim may take it from another thread, so it is updated with interlocked operations.
+        Slab* volatile pSlab;
+        bool fRecentlyUsed;
+        ThreadSlabCache* pNext;
+
+        ThreadSlabCache();
+        ~ThreadSlabCache();
+    };
+
+    static thread_local ThreadSlabCache t_threadSlabCache;
+
     CrstStatic m_jitSlabAllocatorCrst;
     Slab* m_pCurrentCachedList;
     Slab* m_pPreviousCachedList;
+    ThreadSlabCache* m_pThreadSlabCaches;
     size_t m_totalCached;
     DWORD m_lastFlush;
 
@@ -30,6 +47,9 @@ private:
     void init();
     void reclaim();
 
+    bool registerThreadSlabCache(ThreadSlabCache* pCache);
+    void unregisterThreadSlabCache_Locked(ThreadSlabCache* pCache);
+
 public:
     virtual void* allocateMemory(size_t size);
     virtual void freeMemory(void* block);
@@ -13315,7 +13315,24 @@ PCODE UnsafeJitFunction(PrepareCodeConfig* config,
     }
 
     // If the interpreter was loaded, use it.
-    if (interpreterMgr->IsInterpreterLoaded())
+    bool useInterpreter = interpreterMgr->IsInterpreterLoaded();
+
+#if defined(FEATURE_JIT) && defined(FEATURE_TIERED_COMPILATION)
+    // With tier-up enabled the interpreter only produces the initial tier. Code versions created
+    // by call counting promotion (tier-1, instrumented) fall through to the JIT below. Only calls
+    // that go through the method's entry point are counted; calls made from interpreted code
+    // dispatch to the interpreter code directly and neither count nor pick up the promoted code.
+    if (useInterpreter && CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_InterpreterTierUp) != 0)
+    {
+        NativeCodeVersion::OptimizationTier tier = nativeCodeVersion.GetOptimizationTier();
+        if (tier != NativeCodeVersion::OptimizationTier0 && tier != NativeCodeVersion::OptimizationTierOptimized)
+        {
+            useInterpreter = false;
+        }
+    }
+#endif // FEATURE_JIT && FEATURE_TIERED_COMPILATION
+
+    if (useInterpreter)
     {
         CInterpreterJitInfo interpreterJitInfo{ config, ftn, ILHeader, interpreterMgr };
         ret = UnsafeJitFunctionWorker(interpreterMgr, &interpreterJitInfo, nativeCodeVersion, pSizeOfCode);
@@ -14161,6 +14178,9 @@ BOOL LoadDynamicInfoEntry(Module *currentModule,
         }
         break;
 
+    // Load-time validation for code that inlined a method from outside its version bubble: the
+    // compiler records the inlinee's IL body (plus the types its tokens resolve to) and the method
+    // body is only used if the runtime definition still matches it.
     case READYTORUN_FIXUP_Check_IL_Body:
     case READYTORUN_FIXUP_Verify_IL_Body:
         {
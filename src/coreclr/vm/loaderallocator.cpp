@@ -1211,12 +1211,17 @@ void LoaderAllocator::Init(BYTE *pExecutableHeapMemory)
 #if defined(FEATURE_STUBPRECODE_DYNAMIC_HELPERS) && defined(FEATURE_READYTORUN)
     if (IsCollectible())
     {
+        // Collectible allocators rarely need many dynamic helpers, so share the stub precode heap rather than
+        // committing separate interleaved code/data pages for them
         m_pDynamicHelpersStubHeap = m_pNewStubPrecodeHeap;
     }
-    m_pDynamicHelpersStubHeap = new (&m_DynamicHelpersHeapInstance) InterleavedLoaderHeap(
-                                                                               &m_dynamicHelpersRangeList,
-                                                                               false /* fUnlocked */,
-                                                                               &s_stubPrecodeHeapConfig);
+    else
+    {
+        m_pDynamicHelpersStubHeap = new (&m_DynamicHelpersHeapInstance) InterleavedLoaderHeap(
+                                                                                   &m_dynamicHelpersRangeList,
+                                                                                   false /* fUnlocked */,
+                                                                                   &s_stubPrecodeHeapConfig);
+    }
 #endif // defined(FEATURE_STUBPRECODE_DYNAMIC_HELPERS) && defined(FEATURE_READYTORUN)
 
     m_pFixupPrecodeHeap = new (&m_FixupPrecodeHeapInstance) InterleavedLoaderHeap(&m_fixupPrecodeRangeList,
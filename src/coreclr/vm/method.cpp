@@ -2559,6 +2559,26 @@ BOOL MethodDesc::RequiresStableEntryPointCore(BOOL fEstimateForChunk)
 
 #endif // !DACCESS_COMPILE
 
+#ifdef FEATURE_PGO
+//*******************************************************************************
+bool MethodDesc::HasTextFormatPgoData()
+{
+    WRAPPER_NO_CONTRACT;
+
+    BYTE bFlags4 = VolatileLoadWithoutBarrier(&m_bFlags4);
+#ifndef DACCESS_COMPILE
+    if ((bFlags4 & enum_flag4_ComputedHasTextFormatPgoData) == 0)
+    {
+        bool hasData = PgoManager::HasTextFormatPgoData(this);
+        bFlags4 = (BYTE)(enum_flag4_ComputedHasTextFormatPgoData | (hasData ? enum_flag4_HasTextFormatPgoData : 0));
+        InterlockedUpdateFlags4(bFlags4, TRUE);
+    }
+#endif // !DACCESS_COMPILE
+
+    return (bFlags4 & enum_flag4_HasTextFormatPgoData) != 0;
+}
+#endif // FEATURE_PGO
+
 //*******************************************************************************
 BOOL MethodDesc::MayHaveNativeCode()
 {
@@ -1719,6 +1719,12 @@ private:
     BOOL RequiresStableEntryPointCore(BOOL fEstimateForChunk);
 public:
 
+#ifdef FEATURE_PGO
+    // Returns true if PGO data read at startup covers this method. Computed once
+    // by the runtime and cached; the DAC only reads the cached result.
+    bool HasTextFormatPgoData();
+#endif
+
     //
     // Backpatch method slots
     //
@@ -1781,6 +1787,8 @@ protected:
         enum_flag4_RequiresStableEntryPoint                 = 0x02,
         enum_flag4_TemporaryEntryPointAssigned              = 0x04,
         enum_flag4_EnCAddedMethod                           = 0x08,
+        enum_flag4_ComputedHasTextFormatPgoData             = 0x10,
+        enum_flag4_HasTextFormatPgoData                     = 0x20,
     };
 
     void InterlockedSetFlags4(BYTE mask, BYTE newValue);
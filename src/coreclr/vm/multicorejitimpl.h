@@ -72,6 +72,10 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //  5. Maximum number of methods supported is MAX_METHODS
 //  6. Simple module name stored
 //  7. Method flag JIT_BY_APP_THREAD is for diagnosis only
+//  8. Only the initial code version is recorded (tier0, or jitted because R2R code was rejected); promotions to
+//     tier1 happen after the recording window and are not part of the profile. Replaying them would need a new
+//     method flag from the free tag bits, and the PGO schema data to be persisted alongside, since tier1 code
+//     built without it would defeat the purpose of the promotion.
 //
 // <HeaderRecord>::=     <recordType=MULTICOREJIT_HEADER_RECORD_ID> <3byte_recordSize> <version> <timeStamp> <moduleCount> <methodCount> <DependencyCount> <unsigned short counter>*14 <unsigned counter>*3
 // <ModuleRecord>::=     <recordType=MULTICOREJIT_MODULE_RECORD_ID> <3byte_recordSize> <ModuleVersion> <JitMethodCount> <loadLevel> <lenModuleName> char*lenModuleName <padding>
@@ -820,6 +820,9 @@ HRESULT MulticoreJitProfilePlayer::HandleModuleInfoRecord(unsigned moduleTo, uns
     return hr;
 }
 
+// Loads an assembly recorded as a dependency in the profile on the player thread, so that the binding and module load
+// (and the eager fixups of R2R images, resolved when the player prepares the recorded methods) happen ahead of the
+// thread that will first need them. The profile records assemblies in the order they were loaded.
 Assembly * MulticoreJitProfilePlayer::LoadAssembly(SString & assemblyName)
 {
     STANDARD_VM_CONTRACT;
@@ -18,6 +18,11 @@
 // A patchpoint becomes active when the JIT_HELP_PATCHPOINT helper is invoked
 // by jitted code.
 //
+// The state is keyed by method and IL offset, not by frame, so it is shared
+// by every thread running the same loop: hits from all threads count towards
+// the OSR trigger, and once the OSR method exists any frame reaching that
+// patchpoint transitions to it on its next helper call.
+//
 struct PerPatchpointInfo
 {
     PerPatchpointInfo() : 
@@ -734,7 +734,10 @@ FlatImageLayout::FlatImageLayout(PEImage* pOwner)
             if (CompressionNative_InflateInit2_(&zStream, Deflate_DefaultWindowBits) != PAL_Z_OK)
                 ThrowHR(COR_E_BADIMAGEFORMAT);
 
-            int ret = CompressionNative_Inflate(&zStream, PAL_Z_NOFLUSH);
+            // The whole input and output are available up front, so inflate in a single Z_FINISH call.
+            // That lets zlib write straight into the output mapping without copying the decoded data
+            // through its sliding window (the window itself is still allocated by inflateInit).
+            int ret = CompressionNative_Inflate(&zStream, PAL_Z_FINISH);
 
             // decompression should have consumed the entire input
             // and the entire output budgets
@@ -34,6 +34,7 @@ bool PerfMap::s_IndividualAllocationStubReporting = false;
 
 unsigned PerfMap::s_StubsMapped = 0;
 CrstStatic PerfMap::s_csPerfMap;
+LONG PerfMap::s_PendingWrites = 0;
 
 bool PerfMapLowGranularityStubs()
 {
@@ -214,6 +215,7 @@ PerfMap::PerfMap()
 
     // Initialize with no failures.
     m_ErrorEncountered = false;
+    m_BufferUsed = 0;
 }
 
 // Clean-up resources.
@@ -221,6 +223,8 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    FlushBuffer();
+
     delete m_FileStream;
     m_FileStream = nullptr;
 }
@@ -252,8 +256,8 @@ void PerfMap::OpenFile(SString& path)
     }
 }
 
-// Write a line to the map file.
-void PerfMap::WriteLine(SString& line)
+// Write a line to the map file, or buffer it if flush is false.
+void PerfMap::WriteLine(SString& line, bool flush)
 {
     STANDARD_VM_CONTRACT;
 #ifdef _DEBUG
@@ -267,24 +271,67 @@ void PerfMap::WriteLine(SString& line)
 
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
         const char * strLine = line.GetUTF8();
         ULONG inCount = line.GetCount();
-        ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
 
-        if (inCount != outCount)
+        if (m_BufferUsed + inCount > BufferSize)
+        {
+            FlushBuffer();
+        }
+
+        if (inCount > BufferSize)
         {
-            // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
-            m_ErrorEncountered = true;
+            // Too long to buffer, write it out directly.
+            WriteToFile(strLine, inCount);
         }
+        else
+        {
+            memcpy(m_Buffer + m_BufferUsed, strLine, inCount);
+            m_BufferUsed += inCount;
 
+            if (flush)
+            {
+                FlushBuffer();
+            }
+        }
     }
     EX_CATCH{} EX_END_CATCH
 }
 
+// Write the given bytes to the map file stream.
+void PerfMap::WriteToFile(const char * data, ULONG count)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_FileStream == nullptr || m_ErrorEncountered)
+    {
+        return;
+    }
+
+    // The PAL already takes a lock when writing, so we don't need to do so here.
+    ULONG outCount;
+    m_FileStream->Write(data, count, &outCount);
+
+    if (count != outCount)
+    {
+        // This will cause us to stop writing to the file.
+        // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+        m_ErrorEncountered = true;
+    }
+}
+
+// Write any buffered lines to the map file.
+void PerfMap::FlushBuffer()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_BufferUsed > 0)
+    {
+        WriteToFile(m_Buffer, (ULONG)m_BufferUsed);
+        m_BufferUsed = 0;
+    }
+}
+
 void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, PrepareCodeConfig *pConfig)
 {
     LIMITED_METHOD_CONTRACT;
@@ -324,12 +371,15 @@ void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t cod
         SString line;
         line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
+        InterlockedIncrement(&s_PendingWrites);
         {
             CrstHolder ch(&(s_csPerfMap));
 
+            // Keep the line buffered if another thread is waiting to write one after it.
+            bool flush = (InterlockedDecrement(&s_PendingWrites) == 0);
             if(s_Current != nullptr)
             {
-                s_Current->WriteLine(line);
+                s_Current->WriteLine(line, flush);
             }
 
             PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
@@ -435,12 +485,15 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
         SString line;
         line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
+        InterlockedIncrement(&s_PendingWrites);
         {
             CrstHolder ch(&(s_csPerfMap));
 
+            // Keep the line buffered if another thread is waiting to write one after it.
+            bool flush = (InterlockedDecrement(&s_PendingWrites) == 0);
             if(s_Current != nullptr)
             {
-                s_Current->WriteLine(line);
+                s_Current->WriteLine(line, flush);
             }
 
             PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
@@ -39,20 +39,37 @@ private:
 
     static CrstStatic s_csPerfMap;
 
+    // The number of threads that are about to write a line under s_csPerfMap.
+    static LONG s_PendingWrites;
+
     // The file stream to write the map to.
     CFileStream * m_FileStream;
 
     // Set to true if an error is encountered when writing to the file.
     bool m_ErrorEncountered;
 
+    // Lines are accumulated here and written to the file in batches so that the
+    // file write does not happen under s_csPerfMap for every method and stub.
+    // The buffer is only kept while other threads are waiting to write lines, the
+    // last of them writes it out so no line stays buffered once writes stop.
+    static const size_t BufferSize = 4096;
+    char m_Buffer[BufferSize];
+    size_t m_BufferUsed;
+
     // Construct a new map
     PerfMap();
 
     // Open a perfmap map for the specified pid
     void OpenFileForPid(int pid, const char* basePath);
 
-    // Write a line to the map file.
-    void WriteLine(SString & line);
+    // Write a line to the map file, or buffer it if flush is false.
+    void WriteLine(SString & line, bool flush);
+
+    // Write the given bytes to the map file stream.
+    void WriteToFile(const char * data, ULONG count);
+
+    // Write any buffered lines to the map file.
+    void FlushBuffer();
 
     // Default to /tmp or use DOTNET_PerfMapJitDumpPath if set
     static const char* InternalConstructPath();
@@ -351,10 +351,12 @@ void ReadLineAndDiscard(FILE* file)
 #ifndef DACCESS_COMPILE
 void PgoManager::ReadPgoData()
 {
-    // Skip, if we're not reading, or we're writing profile data, or doing tiered pgo
+    // Skip, if we're not reading, or we're writing profile data.
     //
-    if (g_pConfig->TieredPGO() ||
-        (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0) ||
+    // With tiered pgo enabled, methods covered by the data read here skip the instrumented tiers
+    // (see HasTextFormatPgoData), so a profile written by a previous run stands in for re-instrumenting.
+    //
+    if ((CLRConfig::GetConfigValue(CLRConfig::INTERNAL_WritePGOData) > 0) ||
         (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ReadPGOData) == 0))
     {
         return;
@@ -846,6 +848,25 @@ HRESULT PgoManager::getPgoInstrumentationResults(MethodDesc* pMD, BYTE** pAlloca
     return hr;
 }
 
+bool PgoManager::HasTextFormatPgoData(MethodDesc* pMD)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (s_textFormatPgoData.GetCount() == 0)
+    {
+        return false;
+    }
+
+    int codehash;
+    unsigned ilSize;
+    if (!GetVersionResilientILCodeHashCode(pMD, &codehash, &ilSize))
+    {
+        return false;
+    }
+
+    return s_textFormatPgoData.Lookup(CodeAndMethodHash(codehash, pMD->GetStableHash())) != NULL;
+}
+
 HRESULT PgoManager::getPgoInstrumentationResultsFromText(MethodDesc* pMD, BYTE** pAllocatedData, ICorJitInfo::PgoInstrumentationSchema** ppSchema, UINT32* pCountSchemaItems, BYTE** pInstrumentationData, ICorJitInfo::PgoSource* pPgoSource)
 {
     int codehash;
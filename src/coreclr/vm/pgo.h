@@ -18,6 +18,9 @@ public:
     static void Initialize();
     static void Shutdown();
 
+    // True if a profile read in via ReadPGOData already covers this method
+    static bool HasTextFormatPgoData(MethodDesc* pMD);
+
 #endif // FEATURE_PGO
 
 public:
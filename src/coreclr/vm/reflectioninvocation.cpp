@@ -308,6 +308,10 @@ public:
     }
 };
 
+// This is the interpreted invoke path. The managed invokers switch to an emitted, strongly-typed invoke stub
+// once a method has been invoked more than once (or use this path only when dynamic code is not supported), so
+// this path is expected to be hit for first calls. The per-signature state it needs, the frame size and argument
+// iterator flags, is cached in the SignatureNative by ArgIteratorForMethodInvoke.
 extern "C" void QCALLTYPE RuntimeMethodHandle_InvokeMethod(
     QCall::ObjectHandleOnStack target,
     PVOID* args, // An array of byrefs
@@ -157,16 +157,28 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
 
     HashDatum Data;
 
+    // Don't use FOH for collectible modules to avoid potential memory leaks
+    const bool preferFrozenObjectHeap = !bIsCollectible;
+
+    // Entries in the loader allocator's map stay referenced until the map is destroyed, so it may be looked up without
+    // taking the global map lock. Literals that were already interned through this loader allocator are found here.
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+    if (m_StringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+    {
+        StringLiteralEntry *pEntry = (StringLiteralEntry*)Data;
+        STRINGREF *pStrObj = pEntry->GetStringObject();
+        _ASSERTE(pStrObj != NULL);
+
+        if (ppPinnedString != nullptr && preferFrozenObjectHeap && pEntry->IsStringFrozen())
+        {
+            *ppPinnedString = *reinterpret_cast<void**>(pStrObj);
+        }
+        return pStrObj;
+    }
+
     // Retrieve the string literal from the global string literal map.
     CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
-    // TODO: We can be more efficient by checking our local hash table now to see if
-    // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-    // (Rather than waiting until after we look the string up in the global map)
-
-    // Don't use FOH for collectible modules to avoid potential memory leaks
-    const bool preferFrozenObjectHeap = !bIsCollectible;
     StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound, preferFrozenObjectHeap));
 
     _ASSERTE(pEntry || !bAddIfNotFound);
@@ -174,30 +186,18 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     // If pEntry is non-null then the entry exists in the Global map. (either we retrieved it or added it just now)
     if (pEntry)
     {
-        // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-        // hashentry in the appdomain specific map.
-        // TODO: except that by not inserting into our local table we always take the global map lock
-        // and come into this path, when we could succeed at a lock free lookup above.
-
-        if (bIsCollectible)
+        // Also add the entry to this loader allocator's map, so that later lookups of the same literal succeed above
+        // without taking the global map lock. Make sure some other thread has not already added it.
+        if (!m_StringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
         {
-            // Make sure some other thread has not already added it.
-            if (!m_StringToEntryHashTable->GetValue(pStringData, &Data))
-            {
-                // Insert the handle to the string into the hash table.
-                m_StringToEntryHashTable->InsertValue(pStringData, (LPVOID)pEntry, FALSE);
-            }
-            else
-            {
-                pEntry.Release(); //while we're still under lock
-            }
+            // Insert the handle to the string into the hash table.
+            m_StringToEntryHashTable->InsertValue(pStringData, (LPVOID)pEntry, FALSE);
         }
-#ifdef _DEBUG
         else
         {
-            LOG((LF_APPDOMAIN, LL_INFO10000, "Avoided adding String literal to appdomain map: size: %d bytes\n", pStringData->GetCharCount()));
+            pEntry.Release(); //while we're still under lock
         }
-#endif
+
         pEntry.SuppressRelease();
         STRINGREF *pStrObj = NULL;
         // Retrieve the string objectref from the string literal entry.
@@ -245,10 +245,6 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
     {
         CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
-        // TODO: We can be more efficient by checking our local hash table now to see if
-        // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-        // (Rather than waiting until after we look the string up in the global map)
-
         // Retrieve the string literal from the global string literal map.
 
         StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetInternedString(pString, dwHash, bAddIfNotFound));
@@ -258,27 +254,22 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
         // If pEntry is non-null then the entry exists in the Global map. (either we retrieved it or added it just now)
         if (pEntry)
         {
-            // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-            // hashentry in the appdomain specific map.
-            // TODO: except that by not inserting into our local table we always take the global map lock
-            // and come into this path, when we could succeed at a lock free lookup above.
+            // Also add the entry to this loader allocator's map, so that later lookups succeed above without taking the
+            // global map lock.
 
-            if (bIsCollectible)
+            // Since GlobalStringLiteralMap::GetInternedString() could have caused a GC,
+            // we need to recreate the string data.
+            StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
+
+            // Make sure some other thread has not already added it.
+            if (!m_StringToEntryHashTable->GetValue(&StringData, &Data))
+            {
+                // Insert the handle to the string into the hash table.
+                m_StringToEntryHashTable->InsertValue(&StringData, (LPVOID)pEntry, FALSE);
+            }
+            else
             {
-                // Since GlobalStringLiteralMap::GetInternedString() could have caused a GC,
-                // we need to recreate the string data.
-                StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
-
-                // Make sure some other thread has not already added it.
-                if (!m_StringToEntryHashTable->GetValue(&StringData, &Data))
-                {
-                    // Insert the handle to the string into the hash table.
-                    m_StringToEntryHashTable->InsertValue(&StringData, (LPVOID)pEntry, FALSE);
-                }
-                else
-                {
-                    pEntry.Release(); // while we're under lock
-                }
+                pEntry.Release(); // while we're under lock
             }
             pEntry.SuppressRelease();
             // Retrieve the string objectref from the string literal entry.
@@ -1229,7 +1229,18 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
             if (*keyv)
             {
                 _ASSERTE (pSB);
-                GCDeleteSyncBlock(pSB);
+                if (pSB->m_Monitor.m_SemEvent.IsValid())
+                {
+                    // The object is alive but its monitor is idle. Closing the lock event's
+                    // handle isn't safe while the EE is suspended, so leave destroying the
+                    // block to the finalizer thread.
+                    cleanup = TRUE;
+                    InsertCleanupSyncBlock(pSB);
+                }
+                else
+                {
+                    GCDeleteSyncBlock(pSB);
+                }
                 //clean the object syncblock header
                 ((Object*)(*keyv))->GetHeader()->GCResetIndex();
             }
@@ -2291,10 +2302,10 @@ void AwareLock::AllocLockSemEvent()
     }
     CONTRACTL_END;
 
-    // Before we switch from cooperative, ensure that this syncblock won't disappear
-    // under us.  For something as expensive as an event, do it permanently rather
-    // than transiently.
-    SetPrecious();
+    // The caller holds a transient reference, so this syncblock won't disappear under us
+    // while we switch from cooperative. The event does not make the syncblock precious:
+    // once the lock is idle again the GC may reclaim both (see GCWeakPtrScanElement).
+    _ASSERTE(m_TransientPrecious > 0);
 
     GCX_PREEMP();
 
@@ -2498,6 +2509,10 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
     OBJECTREF obj = GetOwningObject();
 
+    // Contention events identify the lock (this) and its object, and ContentionLockCreated is
+    // fired once per lock, so per-lock aggregation can be done by the consumer. Stacks come from
+    // the session's stack collection on ContentionStart; the runtime keeps only the process-wide
+    // count above.
     int64_t startTicks = 0;
     bool isContentionKeywordEnabled = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_CONTENTION_KEYWORD);
 
@@ -36,6 +36,12 @@
 //    is why the variation between collectible and non-collectible gc statics access is handled by
 //    a single byte in the index itself. The intent is that access to statics shall be as simple as
 //    reading the index from a MethodTable, and then using a very straightforward pattern from there.
+// 3. The JIT only expands the pattern above inline for non-collectible types (see the
+//    CORINFO_HELP_GETDYNAMIC_*THREADSTATIC_BASE_NOCTOR_OPTIMIZED helpers). Collectible types are routed to the
+//    MethodTable-based helpers by CEEInfo::getFieldInfo, since getThreadLocalFieldInfo only reports an index offset into
+//    the non-collectible array and CORINFO_THREAD_STATIC_BLOCKS_INFO does not describe the collectible array. Inlining
+//    steps 8-10 for collectible types would require both to be extended, and the handles found there remain valid only
+//    because code from a collectible LoaderAllocator cannot run once it has started unloading.
 
 
 #ifndef __THREADLOCALSTORAGE_H__
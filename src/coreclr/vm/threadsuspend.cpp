@@ -3263,6 +3263,15 @@ COR_PRF_SUSPEND_REASON GCSuspendReasonToProfSuspendReason(ThreadSuspend::SUSPEND
 // We then resume the thread, and it immediately starts executing our "redirect" routine,
 // which leaves cooperative mode and waits for the GC to complete.
 //
+// On Unix there is no context-based redirection; Hijack injects an activation signal
+// instead, and threads in managed loops without a return address to hijack are caught
+// at the fully-interruptible points or the GC polls the JIT emits while
+// TrapReturningThreads is set. A page-protection based poll would need JIT and GC-info
+// support and is not implemented. The retry loop below backs off adaptively (5us after
+// progress, otherwise doubling up to 100us) so that re-signalling a large number of
+// threads does not dominate the pause. Time-to-suspend can be measured from the
+// GCSuspendEEBegin/GCSuspendEEEnd events; TIME_SUSPEND builds keep finer statistics.
+//
 // See code:Thread#SuspendingTheRuntime for more
 void ThreadSuspend::SuspendAllThreads()
 {
@@ -59,6 +59,8 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREventStatic TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+UINT32 TieredCompilationManager::s_helperWorkerCount = 0;
+bool TieredCompilationManager::s_isPendingCallCountingStubDeletion = false;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
@@ -115,8 +117,11 @@ NativeCodeVersion::OptimizationTier TieredCompilationManager::GetInitialOptimiza
         // For ILOnly it depends on TieredPGO_InstrumentOnlyHotCode:
         // 1 - OptimizationTier0 as we don't want to instrument the initial version (will only instrument hot Tier0)
         // 2 - OptimizationTier0Instrumented - instrument all ILOnly code
+        // Methods already covered by PGO data read at startup don't need to be instrumented again;
+        // that is decided once per method and cached on the MethodDesc.
         if (g_pConfig->TieredPGO_InstrumentOnlyHotCode() ||
-            ExecutionManager::IsReadyToRunCode(pMethodDesc->GetNativeCode()))
+            ExecutionManager::IsReadyToRunCode(pMethodDesc->GetNativeCode()) ||
+            pMethodDesc->HasTextFormatPgoData())
         {
             return NativeCodeVersion::OptimizationTier0;
         }
@@ -283,7 +288,8 @@ void TieredCompilationManager::AsyncPromoteToTier1(
     if (g_pConfig->TieredPGO())
     {
         if (currentNativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 &&
-            g_pConfig->TieredPGO_InstrumentOnlyHotCode())
+            g_pConfig->TieredPGO_InstrumentOnlyHotCode() &&
+            !pMethodDesc->HasTextFormatPgoData())
         {
             if (ExecutionManager::IsReadyToRunCode(currentNativeCodeVersion.GetNativeCode()))
             {
@@ -529,7 +535,8 @@ void TieredCompilationManager::BackgroundWorkerStart()
             continue;
         }
 
-        if ((m_isPendingCallCountingCompletion || m_countOfMethodsToOptimize != 0) &&
+        if ((m_isPendingCallCountingCompletion || m_countOfMethodsToOptimize != 0 ||
+                (s_isPendingCallCountingStubDeletion && s_helperWorkerCount == 0)) &&
             !DoBackgroundWork(&workDurationTicks, minWorkDurationTicks, maxWorkDurationTicks))
         {
             // Background work was interrupted due to the tiering delay being activated
@@ -540,7 +547,8 @@ void TieredCompilationManager::BackgroundWorkerStart()
         {
             LockHolder tieredCompilationLockHolder;
 
-            if (IsTieringDelayActive() || m_isPendingCallCountingCompletion || m_countOfMethodsToOptimize != 0)
+            if (IsTieringDelayActive() || m_isPendingCallCountingCompletion || m_countOfMethodsToOptimize != 0 ||
+                (s_isPendingCallCountingStubDeletion && s_helperWorkerCount == 0))
             {
                 continue;
             }
@@ -574,6 +582,224 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+// Helper workers only jit and activate methods from the optimization queue. Call counting completion and the deletion of
+// call counting stubs remain the responsibility of the background worker. A helper is only requested while the queue is
+// long enough to keep each running thread busy, and helpers exit as soon as the queue is drained or the tiering delay is
+// activated. If the background worker drained the queue while helpers were still activating methods, it defers deleting
+// the stubs and the last helper to exit schedules the background worker again to do so.
+bool TieredCompilationManager::TryReserveHelperWorker_Locked()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsLockOwnedByCurrentThread());
+
+    // Minimum number of queued methods per running worker before another helper is started
+    const UINT32 MethodsToOptimizePerWorker = 8;
+
+    UINT32 workerCount = s_helperWorkerCount + 1;
+    if (workerCount >= g_pConfig->TieredCompilation_BackgroundWorkerCount() ||
+        m_countOfMethodsToOptimize < workerCount * MethodsToOptimizePerWorker)
+    {
+        return false;
+    }
+
+    ++s_helperWorkerCount;
+    return true;
+}
+
+// Returns true if the caller must call CreateBackgroundWorkerForStubDeletion() after releasing the lock
+bool TieredCompilationManager::ReleaseHelperWorker_Locked()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsLockOwnedByCurrentThread());
+    _ASSERTE(s_helperWorkerCount != 0);
+
+    --s_helperWorkerCount;
+    if (s_helperWorkerCount != 0 || !s_isPendingCallCountingStubDeletion)
+    {
+        return false;
+    }
+
+    return !TryScheduleBackgroundWorkerWithoutGCTrigger_Locked();
+}
+
+void TieredCompilationManager::CreateBackgroundWorkerForStubDeletion()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    EX_TRY
+    {
+        CreateBackgroundWorker();
+    }
+    EX_CATCH
+    {
+        // The deletion remains pending and is retried the next time the background worker runs
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::CreateBackgroundWorkerForStubDeletion: "
+            "Exception creating background worker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH
+}
+
+void TieredCompilationManager::CreateHelperWorker()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsLockOwnedByCurrentThread());
+    _ASSERTE(s_helperWorkerCount != 0);
+
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartmentOfUnstartedThread(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, HelperWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Helper")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        // Failing to start a helper is not fatal, the background worker continues to process the queue
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::CreateHelperWorker: "
+            "Exception creating helper worker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+
+        // This runs on the background worker, which is still processing work, so it does not need to be scheduled again
+        LockHolder tieredCompilationLockHolder;
+        bool createBackgroundWorker = ReleaseHelperWorker_Locked();
+        _ASSERTE(!createBackgroundWorker);
+    }
+    EX_END_CATCH
+}
+
+DWORD WINAPI TieredCompilationManager::HelperWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        bool createBackgroundWorker;
+        {
+            LockHolder tieredCompilationLockHolder;
+            createBackgroundWorker = ReleaseHelperWorker_Locked();
+        }
+
+        if (createBackgroundWorker)
+        {
+            CreateBackgroundWorkerForStubDeletion();
+        }
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(HelperWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::HelperWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->HelperWorkerStart();
+}
+
+void TieredCompilationManager::HelperWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        bool createBackgroundWorker = false;
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            if (!IsTieringDelayActive())
+            {
+                nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+            }
+
+            if (nativeCodeVersionToOptimize.IsNull())
+            {
+                createBackgroundWorker = ReleaseHelperWorker_Locked();
+            }
+        }
+
+        if (nativeCodeVersionToOptimize.IsNull())
+        {
+            if (createBackgroundWorker)
+            {
+                CreateBackgroundWorkerForStubDeletion();
+            }
+            return;
+        }
+
+        OptimizeMethod(nativeCodeVersionToOptimize);
+
+        // Give preference to possibly more important foreground work between methods
+        ClrSleepEx(0, false);
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -719,7 +945,7 @@ bool TieredCompilationManager::DoBackgroundWork(
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(GetThread() == s_backgroundWorkerThread);
-    _ASSERTE(m_isPendingCallCountingCompletion || m_countOfMethodsToOptimize != 0);
+    _ASSERTE(m_isPendingCallCountingCompletion || m_countOfMethodsToOptimize != 0 || s_isPendingCallCountingStubDeletion);
     _ASSERTE(workDurationTicksRef != nullptr);
     _ASSERTE(minWorkDurationTicks <= maxWorkDurationTicks);
 
@@ -739,6 +965,7 @@ bool TieredCompilationManager::DoBackgroundWork(
 
     bool sendStopEvent = true;
     bool allMethodsJitted = false;
+    bool deleteCallCountingStubs = false;
     UINT32 jittedMethodCount = 0;
     int64_t startTicks = minipal_hires_ticks();
     int64_t previousTicks = startTicks;
@@ -746,6 +973,7 @@ bool TieredCompilationManager::DoBackgroundWork(
     do
     {
         bool completeCallCounting = false;
+        bool createHelperWorker = false;
         NativeCodeVersion nativeCodeVersionToOptimize;
         {
             LockHolder tieredCompilationLockHolder;
@@ -790,13 +1018,26 @@ bool TieredCompilationManager::DoBackgroundWork(
                     }
                     else
                     {
+                        // Methods dequeued by helper workers may still be getting activated. In that case leave the stubs
+                        // to be deleted once the last helper exits, see ReleaseHelperWorker_Locked().
                         allMethodsJitted = true;
+                        deleteCallCountingStubs = s_helperWorkerCount == 0;
+                        s_isPendingCallCountingStubDeletion = !deleteCallCountingStubs;
                         break;
                     }
                 }
+                else
+                {
+                    createHelperWorker = TryReserveHelperWorker_Locked();
+                }
             }
         }
 
+        if (createHelperWorker)
+        {
+            CreateHelperWorker();
+        }
+
         _ASSERTE(completeCallCounting == !!nativeCodeVersionToOptimize.IsNull());
         if (completeCallCounting)
         {
@@ -903,7 +1144,7 @@ bool TieredCompilationManager::DoBackgroundWork(
         ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(countOfMethodsToOptimize, jittedMethodCount);
     }
 
-    if (allMethodsJitted)
+    if (deleteCallCountingStubs)
     {
         EX_TRY
         {
@@ -62,6 +62,15 @@ private:
     static void BackgroundWorkerBootstrapper1(LPVOID args);
     void BackgroundWorkerStart();
 
+private:
+    bool TryReserveHelperWorker_Locked();
+    static bool ReleaseHelperWorker_Locked();
+    static void CreateHelperWorker();
+    static void CreateBackgroundWorkerForStubDeletion();
+    static DWORD WINAPI HelperWorkerBootstrapper0(LPVOID args);
+    static void HelperWorkerBootstrapper1(LPVOID args);
+    void HelperWorkerStart();
+
 private:
     bool TryDeactivateTieringDelay();
 
@@ -124,6 +133,8 @@ private:
     static CLREventStatic s_backgroundWorkAvailableEvent;
     static bool s_isBackgroundWorkerRunning;
     static bool s_isBackgroundWorkerProcessingWork;
+    static UINT32 s_helperWorkerCount;
+    static bool s_isPendingCallCountingStubDeletion;
 #endif // !DACCESS_COMPILE
 
 private:
@@ -2147,6 +2147,11 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
                 }
                 else if (stubKind == STUB_CODE_BLOCK_VSD_RESOLVE_STUB)
                 {
+                    // Resolve stubs are shared by every call site using the same token, so there
+                    // is no per-site state to cache types in here; all that the stub has is the
+                    // global g_resolveCache (with its chains, under CHAIN_LOOKUP). A per-site
+                    // polymorphic cache would need a new stub kind, generated per site, with its
+                    // own per-architecture assembly and fail path falling back to the resolve stub.
                     insertKind = DispatchCache::IK_RESOLVE;
                 }
             }
@@ -760,6 +760,8 @@ mono_image_init (MonoImage *image)
 				       g_direct_hash,
 				       class_key_extract,
 				       class_next_value);
+	image->method_cache = mono_conc_hashtable_new (NULL, NULL);
+	image->methodref_cache = mono_conc_hashtable_new (NULL, NULL);
 	image->field_cache = mono_conc_hashtable_new (NULL, NULL);
 
 	image->typespec_cache = mono_conc_hashtable_new (NULL, NULL);
@@ -2066,10 +2068,8 @@ mono_image_close_except_pools (MonoImage *image)
 		g_free (image->version);
 	}
 
-	if (image->method_cache)
-		dn_simdhash_free (image->method_cache);
-	if (image->methodref_cache)
-		dn_simdhash_free (image->methodref_cache);
+	mono_conc_hashtable_destroy (image->method_cache);
+	mono_conc_hashtable_destroy (image->methodref_cache);
 	mono_internal_hash_table_destroy (&image->class_cache);
 	mono_conc_hashtable_destroy (image->field_cache);
 	if (image->array_cache) {
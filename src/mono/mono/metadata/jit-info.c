@@ -693,6 +693,12 @@ jit_info_table_add (MonoJitInfoTable *volatile *table_ptr, MonoJitInfo *ji)
 	//jit_info_table_check (table);
 }
 
+/*
+ * The lock only serializes writers against each other; lookups never take it and run
+ * concurrently with an insertion, see the comments above. Code is usually allocated at
+ * increasing addresses, so most insertions land at the end of the last chunk and don't
+ * need to shift anything, which keeps the time spent holding the lock short.
+ */
 void
 mono_jit_info_table_add (MonoJitInfo *ji)
 {
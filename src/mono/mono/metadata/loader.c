@@ -1174,53 +1174,36 @@ mono_get_method_checked (MonoImage *image, guint32 token, MonoClass *klass, Mono
 
 	/* FIXME: method definition lookups for metadata-update probably end up here */
 
-	/* We do everything inside the lock to prevent creation races */
-
 	error_init (error);
 
-	mono_image_lock (image);
-
-	if (mono_metadata_token_table (token) == MONO_TABLE_METHOD) {
-		if (!image->method_cache)
-			image->method_cache = dn_simdhash_u32_ptr_new (0, NULL);
-		dn_simdhash_u32_ptr_try_get_value (image->method_cache, mono_metadata_token_index (token), (void **)&result);
-	} else if (!image_is_dynamic (image)) {
-		if (!image->methodref_cache)
-			image->methodref_cache = dn_simdhash_u32_ptr_new (0, NULL);
-		dn_simdhash_u32_ptr_try_get_value (image->methodref_cache, token, (void **)&result);
-	}
-	mono_image_unlock (image);
+	/* Lookups are lock-free, only insertions take the image lock */
+	if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
+		result = (MonoMethod *)mono_conc_hashtable_lookup (image->method_cache, GUINT_TO_POINTER (mono_metadata_token_index (token)));
+	else if (!image_is_dynamic (image))
+		result = (MonoMethod *)mono_conc_hashtable_lookup (image->methodref_cache, GUINT_TO_POINTER (token));
 
 	if (result)
 		return result;
 
-
 	result = mono_get_method_from_token (image, token, klass, context, &used_context, error);
 	if (!result)
 		return NULL;
 
-	mono_image_lock (image);
 	if (!used_context && !result->is_inflated) {
 		MonoMethod *result2 = NULL;
 
+		/* If another thread raced us, the insertion returns its method and we use that one */
+		mono_image_lock (image);
 		if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
-			dn_simdhash_u32_ptr_try_get_value (image->method_cache, mono_metadata_token_index (token), (void **)&result2);
+			result2 = (MonoMethod *)mono_conc_hashtable_insert (image->method_cache, GUINT_TO_POINTER (mono_metadata_token_index (token)), result);
 		else if (!image_is_dynamic (image))
-			dn_simdhash_u32_ptr_try_get_value (image->methodref_cache, token, (void **)&result2);
+			result2 = (MonoMethod *)mono_conc_hashtable_insert (image->methodref_cache, GUINT_TO_POINTER (token), result);
+		mono_image_unlock (image);
 
-		if (result2) {
-			mono_image_unlock (image);
+		if (result2)
 			return result2;
-		}
-
-		if (mono_metadata_token_table (token) == MONO_TABLE_METHOD)
-			dn_simdhash_u32_ptr_try_add (image->method_cache, mono_metadata_token_index (token), result);
-		else if (!image_is_dynamic (image))
-			dn_simdhash_u32_ptr_try_add (image->methodref_cache, token, result);
 	}
 
-	mono_image_unlock (image);
-
 	return result;
 }
 
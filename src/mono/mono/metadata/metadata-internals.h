@@ -420,11 +420,11 @@ struct _MonoImage {
 	/*
 	 * Indexed by method tokens and typedef tokens.
 	 */
-	dn_simdhash_u32_ptr_t *method_cache; /*protected by the image lock*/
+	MonoConcurrentHashTable *method_cache; /* lock-free lookups, inserts take the image lock */
 	MonoInternalHashTable class_cache;
 
 	/* Indexed by memberref + methodspec tokens */
-	dn_simdhash_u32_ptr_t *methodref_cache; /*protected by the image lock*/
+	MonoConcurrentHashTable *methodref_cache; /* lock-free lookups, inserts take the image lock */
 
 	/*
 	 * Indexed by fielddef and memberref tokens
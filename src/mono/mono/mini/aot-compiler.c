@@ -13952,6 +13952,90 @@ add_profile_instances (MonoAotCompile *acfg, ProfileData *data)
 	printf ("Added %d methods from profile.\n", count);
 }
 
+typedef struct {
+	/* Position of the profile in ACFG->PROFILE_DATA, ids are only ordered within one profile */
+	int profile_index;
+	int id;
+	guint32 index;
+} ProfileMethodOrder;
+
+static gint
+compare_profile_method_order (ProfileMethodOrder *a, ProfileMethodOrder *b)
+{
+	if (a->profile_index != b->profile_index)
+		return a->profile_index - b->profile_index;
+	return a->id - b->id;
+}
+
+/*
+ * reorder_methods_by_profile:
+ *
+ *   Move the compiled methods which appear in the profile to the start of METHOD_ORDER,
+ * in the order the profiler recorded them, i.e. the order they were first executed.
+ * With several profiles, the methods of each profile are kept together in the order
+ * the profiles were given, since ids from different profiles can't be compared.
+ * The remaining methods follow in their original order, so the code run at startup
+ * ends up on a contiguous range of pages instead of being spread over the whole image.
+ */
+static void
+reorder_methods_by_profile (MonoAotCompile *acfg)
+{
+	GArray *hot = g_array_new (FALSE, FALSE, sizeof (ProfileMethodOrder));
+	guint8 *is_hot = g_new0 (guint8, acfg->cfgs_size);
+	int profile_index = 0;
+
+	for (GList *l = acfg->profile_data; l; l = l->next, profile_index ++) {
+		ProfileData *data = (ProfileData*)l->data;
+		GHashTableIter iter;
+		gpointer key, value;
+
+		g_hash_table_iter_init (&iter, data->methods);
+		while (g_hash_table_iter_next (&iter, &key, &value)) {
+			MethodProfileData *mdata = (MethodProfileData*)value;
+			ProfileMethodOrder entry;
+			guint32 index;
+
+			if (!mdata->method)
+				continue;
+			index = GPOINTER_TO_UINT (g_hash_table_lookup (acfg->method_indexes, mdata->method));
+			if (!index)
+				continue;
+			index --;
+			if (!acfg->cfgs [index] || is_hot [index])
+				continue;
+
+			is_hot [index] = 1;
+			entry.profile_index = profile_index;
+			entry.id = mdata->id;
+			entry.index = index;
+			g_array_append_val (hot, entry);
+		}
+	}
+
+	if (hot->len) {
+		GPtrArray *new_order = g_ptr_array_sized_new (acfg->method_order->len);
+
+		mono_qsort (hot->data, hot->len, sizeof (ProfileMethodOrder), (int (*)(const void *, const void *))compare_profile_method_order);
+		for (guint i = 0; i < hot->len; ++i)
+			g_ptr_array_add (new_order, GUINT_TO_POINTER (g_array_index (hot, ProfileMethodOrder, i).index));
+		for (guint oindex = 0; oindex < acfg->method_order->len; ++oindex) {
+			guint32 index = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, oindex));
+
+			if (index < GINT_TO_UINT32 (acfg->cfgs_size) && is_hot [index])
+				continue;
+			g_ptr_array_add (new_order, GUINT_TO_POINTER (index));
+		}
+
+		g_ptr_array_free (acfg->method_order, TRUE);
+		acfg->method_order = new_order;
+
+		aot_printf (acfg, "Moved %d profiled methods to the start of the code section.\n", hot->len);
+	}
+
+	g_free (is_hot);
+	g_array_free (hot, TRUE);
+}
+
 typedef enum {
 	FIND_METHOD_TYPE_ENTRY_START,
 	FIND_METHOD_TYPE_ENTRY_END,
@@ -15542,6 +15626,9 @@ emit_aot_image (MonoAotCompile *acfg)
 	if (acfg->fp)
 		acfg->w = mono_img_writer_create (acfg->fp);
 
+	if (acfg->profile_data)
+		reorder_methods_by_profile (acfg);
+
 	/* Compute symbols for methods */
 	for (guint32 i = 0; i < acfg->nmethods; ++i) {
 		if (acfg->cfgs [i]) {
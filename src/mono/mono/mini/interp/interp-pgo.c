@@ -5,6 +5,10 @@
 
 // This file implements most of interpreter automatic PGO.
 // Loading/saving the actual table is your responsibility via mono_interp_pgo_(load|save)_table
+// The table only records *which* methods were tiered up in a previous run (as hashes of their
+//  signature), so they can be generated with optimizations on the first call. No type, call
+//  target or branch profiles are collected; a profile-guided tier above the optimized one
+//  would need per-call-site counters in the unoptimized code first.
 
 #ifndef __USE_ISOC99
 #define __USE_ISOC99
@@ -3389,6 +3389,10 @@ can_propagate_var_def (TransformData *td, int var, InterpLivenessPosition cur_li
 	return TRUE;
 }
 
+// Fuses a def with its single use into one opcode (imm binops, compare + branch, add + mul,
+// ldind/stind with offset, ...). The fusions are picked statically from the IR of the method,
+// independent of how hot a block is. Loops are the main beneficiary since their compare and
+// increment usually fold into MINT_*_IMM_SP / MINT_ADD_*_IMM forms.
 static void
 interp_super_instructions (TransformData *td)
 {
@@ -70,6 +70,20 @@ static guint64 bytes_allocated_detached = 0;
 #define TLAB_TEMP_END	(__thread_info__->tlab_temp_end)
 #define TLAB_REAL_END	(__thread_info__->tlab_real_end)
 
+/*
+ * Returns the size to request for a new TLAB and grows the one used for the
+ * following refill. A thread that keeps running out of TLAB space before the
+ * next collection gets progressively bigger TLABs, which cuts the number of
+ * trips to the shared nursery fragment list.
+ */
+static size_t
+next_tlab_size (SgenThreadInfo *info)
+{
+	size_t tlab_size = MAX (info->tlab_refill_size, sgen_tlab_size);
+	info->tlab_refill_size = (guint32)MIN (tlab_size * 2, MAX (SGEN_MAX_TLAB_SIZE, sgen_tlab_size));
+	return tlab_size;
+}
+
 static void
 increment_thread_allocation_counter (size_t byte_size)
 {
@@ -269,11 +283,13 @@ sgen_alloc_obj_nolock (GCVTable vtable, size_t size)
 				zero_tlab_if_necessary (p, size);
 			} else {
 				size_t alloc_size = 0;
+				size_t tlab_size;
 				if (TLAB_START)
 					SGEN_LOG (3, "Retire TLAB: %p-%p [%ld]", TLAB_START, TLAB_REAL_END, (long)(TLAB_REAL_END - TLAB_NEXT - size));
 				sgen_nursery_retire_region (p, available_in_tlab);
 
-				p = (void **)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+				tlab_size = next_tlab_size (__thread_info__);
+				p = (void **)sgen_nursery_alloc_range (tlab_size, size, &alloc_size);
 				if (!p) {
 					/* See comment above in similar case. */
 					sgen_ensure_free_space (sgen_tlab_size, GENERATION_NURSERY);
@@ -383,7 +399,7 @@ sgen_try_alloc_obj_nolock (GCVTable vtable, size_t size)
 			size_t alloc_size = 0;
 
 			sgen_nursery_retire_region (p, available_in_tlab);
-			new_next = (char *)sgen_nursery_alloc_range (sgen_tlab_size, size, &alloc_size);
+			new_next = (char *)sgen_nursery_alloc_range (next_tlab_size (__thread_info__), size, &alloc_size);
 			p = (void**)new_next;
 			if (!p)
 				return NULL;
@@ -529,6 +545,7 @@ sgen_clear_tlabs (void)
 		info->tlab_next = NULL;
 		info->tlab_temp_end = NULL;
 		info->tlab_real_end = NULL;
+		info->tlab_refill_size = sgen_tlab_size;
 	} FOREACH_THREAD_END
 
 	sgen_set_bytes_allocated_attached (total_bytes_allocated_globally);
@@ -171,6 +171,15 @@ typedef target_mword SgenDescriptor;
 */
 #define SGEN_MAX_NURSERY_WASTE 512
 
+/*
+ * Upper bound for the size a thread's TLAB can grow to.  Every thread starts with
+ * sgen_tlab_size and doubles its refill size each time it exhausts a TLAB within
+ * the same nursery cycle, so only threads that allocate heavily take big chunks
+ * out of the nursery.  The refill size drops back when the TLABs are cleared at
+ * the next collection.
+ */
+#define SGEN_MAX_TLAB_SIZE (SGEN_SCAN_START_SIZE * 4)
+
 
 /*
  * Max nursery size that we support.
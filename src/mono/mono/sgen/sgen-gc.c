@@ -3068,6 +3068,7 @@ void*
 sgen_thread_attach (SgenThreadInfo* info)
 {
 	info->tlab_start = info->tlab_next = info->tlab_temp_end = info->tlab_real_end = NULL;
+	info->tlab_refill_size = sgen_tlab_size;
 
 	sgen_client_thread_attach (info);
 
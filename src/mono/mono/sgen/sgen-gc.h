@@ -424,6 +424,8 @@ struct _SgenThreadInfo {
 	char *tlab_next;
 	char *tlab_temp_end;
 	char *tlab_real_end;
+	/* Size requested for the next TLAB, see SGEN_MAX_TLAB_SIZE. */
+	guint32 tlab_refill_size;
 
 	/* Total bytes allocated by this thread in its lifetime so far. */
 	gint64 total_bytes_allocated;
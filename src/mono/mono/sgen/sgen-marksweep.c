@@ -183,6 +183,12 @@ static int fast_block_obj_size_indexes [MS_NUM_FAST_BLOCK_OBJ_SIZE_INDEXES];
 
 #define MS_BLOCK_TYPE_MAX	4
 
+/*
+ * Sweep marks a block size for evacuation when its blocks are less than evacuation_threshold
+ * full.  Concurrent collections honour this too: objects in evacuating blocks are not copied
+ * during the concurrent mark, their referrers are recorded in the mod-union card table, and
+ * the copying happens in the finishing pause.
+ */
 static gboolean *evacuate_block_obj_sizes;
 static float evacuation_threshold = 0.666f;
 
@@ -180,7 +180,7 @@ sgen_simple_nursery_init (SgenMinorCollector *collector, gboolean parallel)
 	 * concurrent mark and concurrent sweep.
 	 */
 	if (parallel)
-		sgen_workers_create_context (GENERATION_NURSERY, mono_cpu_count ());
+		sgen_workers_create_context (GENERATION_NURSERY, mono_cpu_limit ());
 #endif
 
 }
@@ -13,7 +13,11 @@
 #include "mono/sgen/sgen-pointer-queue.h"
 #include "mono/utils/mono-threads.h"
 
-#define SGEN_THREADPOOL_MAX_NUM_THREADS 8
+/*
+ * Parallel workers are opt-in through MONO_GC_PARAMS (minor=simple-par, major=marksweep-conc-par),
+ * so this cap only limits processes that asked for parallel collection.
+ */
+#define SGEN_THREADPOOL_MAX_NUM_THREADS 16
 #define SGEN_THREADPOOL_MAX_NUM_CONTEXTS 3
 
 typedef struct _SgenThreadPoolJob SgenThreadPoolJob;
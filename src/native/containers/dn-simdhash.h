@@ -30,6 +30,9 @@ extern "C" {
 // If set, bucket count will be a power of two. If unset, we will use spaced primes.
 // Spaced primes give much better collision resistance for bad hashes, but worsen perf for optimal hashes.
 #define DN_SIMDHASH_POWER_OF_TWO_BUCKETS 0
+// Tables are not thread-safe: inserts can rehash in place and free the old buffers. Read-mostly
+//  shared caches should either use one table per thread (see the interpreter's stack map cache)
+//  or serialize all access, including lookups, with an external lock.
 
 typedef struct dn_simdhash_void_data_t {
 	// HACK: Empty struct or 0-element array produce a MSVC warning and break the build.
@@ -8,6 +8,8 @@
 
 #define INNER_COUNT 47431
 #define BH_INNER_COUNT 2777
+// Small enough that the whole table stays resident in L1
+#define SMALL_INNER_COUNT 61
 #define BASELINE_SIZE 20480
 
 static dn_simdhash_u32_ptr_t *random_u32s_hash;
@@ -78,6 +80,24 @@ retry2: {
     }
 }
 
+static char **random_strings, **random_unused_strings;
+
+static void init_string_data () {
+    if (!random_u32s)
+        init_data();
+
+    random_strings = malloc(sizeof(char *) * INNER_COUNT);
+    random_unused_strings = malloc(sizeof(char *) * INNER_COUNT);
+
+    // Prefix the keys so that they are long enough for the hash, not the compare, to dominate
+    for (uint32_t i = 0; i < INNER_COUNT; i++) {
+        random_strings[i] = malloc(32);
+        snprintf(random_strings[i], 32, "System.Key.%08X", *dn_vector_index_t(random_u32s, uint32_t, i));
+        random_unused_strings[i] = malloc(32);
+        snprintf(random_unused_strings[i], 32, "System.Key.%08X", *dn_vector_index_t(random_unused_u32s, uint32_t, i));
+    }
+}
+
 static uint32_t bad_hash_func (const void * key) {
     return (((size_t)key) & 0xFFF) << 17;
 }
@@ -102,6 +122,32 @@ static void * create_instance_u32_ptr_random_values () {
     return result;
 }
 
+static void * create_instance_u32_ptr_random_values_small () {
+    if (!random_u32s)
+        init_data();
+
+    dn_simdhash_u32_ptr_t *result = dn_simdhash_u32_ptr_new(SMALL_INNER_COUNT, NULL);
+    for (int i = 0; i < SMALL_INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(random_u32s, uint32_t, i);
+        dn_simdhash_u32_ptr_try_add(result, key, (void *)(size_t)i);
+    }
+    return result;
+}
+
+static void * create_instance_string_ptr_random_values () {
+    if (!random_strings)
+        init_string_data();
+
+    dn_simdhash_string_ptr_t *result = dn_simdhash_string_ptr_new(INNER_COUNT, NULL);
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_string_ptr_try_add(result, random_strings[i], (void *)(size_t)i);
+    return result;
+}
+
+static void destroy_instance_string_ptr (void *data) {
+    dn_simdhash_free((dn_simdhash_string_ptr_t *)data);
+}
+
 static void destroy_instance (void *_data) {
     dn_simdhash_u32_ptr_t *data = _data;
     if (!data)
@@ -252,6 +298,28 @@ MEASUREMENT(dn_find_missing_key, dn_simdhash_u32_ptr_t *, create_instance_u32_pt
     }
 })
 
+MEASUREMENT(dn_find_random_keys_small, dn_simdhash_u32_ptr_t *, create_instance_u32_ptr_random_values_small, destroy_instance, {
+    void *temp = NULL;
+    for (int j = 0; j < INNER_COUNT / SMALL_INNER_COUNT; j++) {
+        for (int i = 0; i < SMALL_INNER_COUNT; i++) {
+            uint32_t key = *dn_vector_index_t(random_u32s, uint32_t, i);
+            dn_simdhash_assert(dn_simdhash_u32_ptr_try_get_value(data, key, &temp));
+        }
+    }
+})
+
+MEASUREMENT(dn_find_random_string_keys, dn_simdhash_string_ptr_t *, create_instance_string_ptr_random_values, destroy_instance_string_ptr, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_simdhash_string_ptr_try_get_value(data, random_strings[i], &temp));
+})
+
+MEASUREMENT(dn_find_missing_string_key, dn_simdhash_string_ptr_t *, create_instance_string_ptr_random_values, destroy_instance_string_ptr, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(!dn_simdhash_string_ptr_try_get_value(data, random_unused_strings[i], &temp));
+})
+
 MEASUREMENT(dn_fill_then_remove_every_item, dn_simdhash_u32_ptr_t *, create_instance_u32_ptr, destroy_instance, {
     for (int i = 0; i < INNER_COUNT; i++) {
         uint32_t key = *dn_vector_index_t(random_u32s, uint32_t, i);
@@ -47,6 +47,9 @@ file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version,
     return entry;
 }
 
+// Managed assemblies and the json files are read in place from the mapped bundle. Everything
+// else, native libraries in particular, has to be handed to the OS loader as a file path, so it
+// is extracted; the runtime's own native components are statically linked into the single-file host.
 bool file_entry_t::needs_extraction() const
 {
     if (m_force_extraction)
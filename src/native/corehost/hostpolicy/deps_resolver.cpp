@@ -308,6 +308,9 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
             continue;
         }
 
+        // Existence checks are only needed when more than one location can satisfy an entry
+        // (servicing, shared stores, additional probe paths or additional deps). Otherwise the
+        // first applicable probe is trusted and resolving an entry touches no files.
         uint32_t search_options = m_needs_file_existence_checks ? deps_entry_t::search_options::file_existence : deps_entry_t::search_options::none;
 
         if (config.is_fx())
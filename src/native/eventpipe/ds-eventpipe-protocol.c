@@ -909,6 +909,9 @@ eventpipe_protocol_helper_collect_tracing (
 		}
 	}
 
+	// The session payload is streamed as uncompressed nettrace. Clients that need to cut bandwidth
+	// can disable stack collection (stackwalk_requested), which typically dominates the payload;
+	// compressing the stream would need a new, negotiated wire format understood by the clients.
 	EventPipeSessionOptions options;
 	ep_session_options_init(
 		&options,
@@ -152,6 +152,10 @@ file_write_end (EventPipeFile *file)
 	ep_fast_serializer_write_tag (file->fast_serializer, FAST_SERIALIZER_TAGS_NULL_REFERENCE, NULL, 0);
 }
 
+// Stacks are interned per file: the first occurrence of a stack is written once to the stack
+// block and events reference it by id, with the event block header varint/delta compressing the
+// id against the previous event. The table resets at each sequence point so readers can start
+// decoding from any sequence point.
 static
 uint32_t
 file_get_stack_id (
@@ -505,6 +505,9 @@ event_filter_enables_event_id (
 	return event_filter->enable == contains_event_id;
 }
 
+// Filtering here is by keyword, level and event id only; payloads are opaque to the runtime at this
+// point. Payload-level filtering is left to the provider, which receives the session's filter_data
+// (EventSource exposes it as the EventCommand arguments).
 bool
 ep_session_provider_allows_event (
 	EventPipeSessionProvider *session_provider,
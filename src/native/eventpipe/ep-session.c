@@ -238,6 +238,9 @@ session_is_stream_connection_closed (IpcStream *stream)
  *  session_user_events_tracepoints_init
  *
  *  Registers all configured tracepoints for the user_events eventpipe session.
+ *  Events for this session type bypass the buffer manager: session_tracepoint_write_event
+ *  writes each one to the kernel with a single writev from the emitting thread, so perf and
+ *  eBPF consumers see them alongside kernel events without an in-process agent.
  */
 static
 bool
@@ -148,6 +148,9 @@ typedef enum {
 	EP_SERIALIZATION_FORMAT_COUNT
 } EventPipeSerializationFormat;
 
+// Buffered session types drain their buffer manager continuously; when the per-session buffer
+// budget is exhausted new events are dropped rather than overwriting old ones, so none of these
+// behave as an in-memory flight recorder.
 typedef enum {
 	EP_SESSION_TYPE_FILE,
 	EP_SESSION_TYPE_LISTENER,
@@ -647,6 +647,8 @@ void GlobalizationNative_CloseSortHandle(SortHandle* pSortHandle)
     free(pSortHandle);
 }
 
+// The hot path takes no lock: each per-option collator is cloned once, published with a CAS,
+// and then shared across threads, which ICU allows for const collators used with ucol_strcoll.
 static const UCollator* GetCollatorFromSortHandle(SortHandle* pSortHandle, int32_t options, UErrorCode* pErr)
 {
     if (options == 0)
@@ -1339,3 +1341,52 @@ int32_t GlobalizationNative_GetSortKey(
 
     return result;
 }
+
+/*
+Function:
+GetSortKeys
+
+Writes the sort keys of count strings back to back into sortKeys. keyOffsets must have room for
+count + 1 entries; the key of string i occupies [keyOffsets[i], keyOffsets[i + 1]). Stops at the
+first key that does not fit, so the caller can continue from there with a larger buffer.
+
+Returns the number of keys written, or -1 if the collator could not be obtained.
+*/
+int32_t GlobalizationNative_GetSortKeys(
+                        SortHandle* pSortHandle,
+                        const UChar* const* lpStrs,
+                        const int32_t* cwStrLengths,
+                        int32_t count,
+                        uint8_t* sortKeys,
+                        int32_t cbSortKeysLength,
+                        int32_t* keyOffsets,
+                        int32_t options)
+{
+    UErrorCode err = U_ZERO_ERROR;
+    const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
+
+    if (!U_SUCCESS(err))
+    {
+        return -1;
+    }
+
+    int32_t written = 0;
+    int32_t i = 0;
+    keyOffsets[0] = 0;
+
+    for (; i < count; i++)
+    {
+        int32_t remaining = cbSortKeysLength - written;
+        int32_t keyLength = ucol_getSortKey(pColl, lpStrs[i], cwStrLengths[i], sortKeys + written, remaining);
+
+        if (keyLength == 0 || keyLength > remaining)
+        {
+            break;
+        }
+
+        written += keyLength;
+        keyOffsets[i + 1] = written;
+    }
+
+    return i;
+}
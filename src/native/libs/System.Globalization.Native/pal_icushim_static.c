@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 //
 
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -17,6 +18,13 @@
 
 #if defined(TARGET_UNIX)
 #include <strings.h>
+#if !defined(__EMSCRIPTEN__) && !defined(TARGET_WASI)
+#define USE_MMAP_ICU_DATA
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #elif defined(TARGET_WINDOWS)
 #define strcasecmp _stricmp
 #define strncasecmp _strnicmp
@@ -170,6 +178,38 @@ error:
     return NULL;
 }
 
+#if defined(USE_MMAP_ICU_DATA)
+// Maps the ICU dat file read-only instead of reading it into the heap, so only the pages for
+// the locales and tables actually used are ever faulted in. The mapping is never released,
+// matching the lifetime of the data handed to udata_setCommonData.
+static const char *
+mmap_load_icu_data(const char *path)
+{
+    int fd;
+    while ((fd = open(path, O_RDONLY | O_CLOEXEC)) == -1 && errno == EINTR);
+
+    if (fd == -1)
+    {
+        return NULL;
+    }
+
+    const char *icu_data = NULL;
+    struct stat st;
+
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        void *mapped = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED)
+        {
+            icu_data = (const char *)mapped;
+        }
+    }
+
+    close(fd);
+    return icu_data;
+}
+#endif
+
 int32_t
 GlobalizationNative_LoadICUData(const char* path)
 {
@@ -186,7 +226,17 @@ GlobalizationNative_LoadICUData(const char* path)
     }
 #endif
 
-    const char *icu_data = cstdlib_load_icu_data(path);
+    const char *icu_data = NULL;
+#if defined(USE_MMAP_ICU_DATA)
+    if (path != NULL)
+    {
+        icu_data = mmap_load_icu_data(path);
+    }
+    if (icu_data == NULL)
+#endif
+    {
+        icu_data = cstdlib_load_icu_data(path);
+    }
 
     if (icu_data == NULL)
     {
@@ -147,6 +147,13 @@ int32_t GlobalizationNative_GetSortKey(
     return 0;
 }
 
+int32_t GlobalizationNative_GetSortKeys(
+    SortHandle* pSortHandle, const UChar* const* lpStrs, const int32_t* cwStrLengths, int32_t count, uint8_t* sortKeys, int32_t cbSortKeysLength, int32_t* keyOffsets, int32_t options)
+{
+    assert_msg(false, "Not supported on this platform", 0);
+    return 0;
+}
+
 // Placeholder for locale data
 int32_t GlobalizationNative_GetLocales(
     UChar *value, int32_t valueLength)
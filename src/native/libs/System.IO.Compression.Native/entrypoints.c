@@ -12,26 +12,35 @@
 
 static const Entry s_compressionNative[] =
 {
+    DllImportEntry(BrotliDecoderAttachDictionary)
     DllImportEntry(BrotliDecoderCreateInstance)
     DllImportEntry(BrotliDecoderDecompress)
     DllImportEntry(BrotliDecoderDecompressStream)
     DllImportEntry(BrotliDecoderDestroyInstance)
     DllImportEntry(BrotliDecoderIsFinished)
+    DllImportEntry(BrotliEncoderAttachPreparedDictionary)
     DllImportEntry(BrotliEncoderCompress)
     DllImportEntry(BrotliEncoderCompressStream)
     DllImportEntry(BrotliEncoderCreateInstance)
     DllImportEntry(BrotliEncoderDestroyInstance)
+    DllImportEntry(BrotliEncoderDestroyPreparedDictionary)
     DllImportEntry(BrotliEncoderHasMoreOutput)
     DllImportEntry(BrotliEncoderMaxCompressedSize)
+    DllImportEntry(BrotliEncoderPrepareDictionary)
     DllImportEntry(BrotliEncoderSetParameter)
+    DllImportEntry(CompressionNative_Adler32)
     DllImportEntry(CompressionNative_Crc32)
+    DllImportEntry(CompressionNative_Crc32Combine)
     DllImportEntry(CompressionNative_Deflate)
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateInit2_)
+    DllImportEntry(CompressionNative_DeflateReset)
+    DllImportEntry(CompressionNative_DeflateSetDictionary)
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateInit2_)
     DllImportEntry(CompressionNative_InflateReset2_)
+    DllImportEntry(CompressionNative_InflateSetDictionary)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
@@ -14,10 +14,13 @@
 #include <zlib.h>
 
 c_static_assert(PAL_Z_NOFLUSH == Z_NO_FLUSH);
+c_static_assert(PAL_Z_SYNCFLUSH == Z_SYNC_FLUSH);
+c_static_assert(PAL_Z_FULLFLUSH == Z_FULL_FLUSH);
 c_static_assert(PAL_Z_FINISH == Z_FINISH);
 
 c_static_assert(PAL_Z_OK == Z_OK);
 c_static_assert(PAL_Z_STREAMEND == Z_STREAM_END);
+c_static_assert(PAL_Z_NEEDDICT == Z_NEED_DICT);
 c_static_assert(PAL_Z_STREAMERROR == Z_STREAM_ERROR);
 c_static_assert(PAL_Z_DATAERROR == Z_DATA_ERROR);
 c_static_assert(PAL_Z_MEMERROR == Z_MEM_ERROR);
@@ -144,6 +147,29 @@ int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream)
     return result;
 }
 
+int32_t CompressionNative_DeflateReset(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateReset(zStream);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
+int32_t CompressionNative_DeflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL || dictLength == 0);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateSetDictionary(zStream, dictionary, dictLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_InflateInit2_(PAL_ZStream* stream, int32_t windowBits)
 {
     assert(stream != NULL);
@@ -181,6 +207,18 @@ int32_t CompressionNative_InflateEnd(PAL_ZStream* stream)
     return result;
 }
 
+int32_t CompressionNative_InflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL || dictLength == 0);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = inflateSetDictionary(zStream, dictionary, dictLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_InflateReset2_(PAL_ZStream* stream, int32_t windowBits)
 {
     assert(stream != NULL);
@@ -192,6 +230,15 @@ int32_t CompressionNative_InflateReset2_(PAL_ZStream* stream, int32_t windowBits
     return result;
 }
 
+uint32_t CompressionNative_Adler32(uint32_t adler, uint8_t* buffer, int32_t len)
+{
+    assert(buffer != NULL);
+
+    unsigned long result = adler32(adler, buffer, len);
+    assert(result <= UINT32_MAX);
+    return (uint32_t)result;
+}
+
 uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
 {
     assert(buffer != NULL);
@@ -200,3 +247,12 @@ uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
     assert(result <= UINT32_MAX);
     return (uint32_t)result;
 }
+
+uint32_t CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2)
+{
+    assert(len2 >= 0);
+
+    unsigned long result = crc32_combine(crc1, crc2, (z_off_t)len2);
+    assert(result <= UINT32_MAX);
+    return (uint32_t)result;
+}
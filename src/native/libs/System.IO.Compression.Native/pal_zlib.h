@@ -36,6 +36,8 @@ Allowed flush values for the Deflate and Inflate functions.
 enum PAL_FlushCode
 {
     PAL_Z_NOFLUSH = 0,
+    PAL_Z_SYNCFLUSH = 2,
+    PAL_Z_FULLFLUSH = 3,
     PAL_Z_FINISH = 4,
 };
 
@@ -46,6 +48,7 @@ enum PAL_ErrorCode
 {
     PAL_Z_OK = 0,
     PAL_Z_STREAMEND = 1,
+    PAL_Z_NEEDDICT = 2,
     PAL_Z_STREAMERROR = -2,
     PAL_Z_DATAERROR = -3,
     PAL_Z_MEMERROR = -4,
@@ -102,6 +105,25 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateEnd(PAL_ZStream* stream);
 
+/*
+This function is equivalent to DeflateEnd followed by DeflateInit2_ with the same parameters,
+but does not free and reallocate the internal compression state. This lets a pooled stream
+be reused for another message without reallocating its window.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateReset(PAL_ZStream* stream);
+
+/*
+Primes the compression dictionary with the bytes dictionary[0..dictLength-1]. Must be
+called after DeflateInit2_ and before the first Deflate call. Together with a raw
+deflate stream, a PAL_Z_SYNCFLUSH at the end of each block and Crc32Combine, this lets
+independent blocks be compressed in parallel and concatenated into one deflate stream.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictLength);
+
 /*
 Initializes the PAL_ZStream so the Inflate function can be invoked on it.
 
@@ -124,6 +146,15 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_InflateEnd(PAL_ZStream* stream);
 
+/*
+Sets the preset dictionary used to decompress the stream. For zlib streams this must be
+called after Inflate returns PAL_Z_NEEDDICT; for raw deflate streams it may be called at
+any time after InflateInit2_, and must match the dictionary given to DeflateSetDictionary.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_InflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictLength);
+
 /*
 This function is equivalent to InflateEnd followed by InflateInit, but does not free and reallocate 
 the internal decompression state. The stream's window size will be modified and its memory may be
@@ -133,6 +164,14 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_InflateReset2_(PAL_ZStream* stream, int32_t windowBits);
 
+/*
+Update a running Adler-32 checksum with the bytes buffer[0..len-1] and return the
+updated checksum. The initial value should be 1.
+
+Returns the updated Adler-32 checksum.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENTION CompressionNative_Adler32(uint32_t adler, uint8_t* buffer, int32_t len);
+
 /*
 Update a running CRC-32 with the bytes buffer[0..len-1] and return the
 updated CRC-32.
@@ -140,3 +179,11 @@ updated CRC-32.
 Returns the updated CRC-32.
 */
 FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENTION CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len);
+
+/*
+Combine two CRC-32 check values into one. crc1 is the CRC-32 of a first sequence of
+bytes and crc2 the CRC-32 of a second sequence of len2 bytes.
+
+Returns the CRC-32 of the two sequences concatenated.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENTION CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2);
@@ -164,6 +164,9 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ReceiveSocketError)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_EnableZeroCopySend)
+    DllImportEntry(SystemNative_SendZeroCopy)
+    DllImportEntry(SystemNative_ReceiveZeroCopyCompletion)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -503,6 +503,9 @@ static void ConvertDirent(const struct dirent* entry, DirectoryEntry* outputEntr
 
 // The caller must ensure no calls are made to readdir/closedir since those will invalidate
 // the current dirent. We assume the platform supports concurrent readdir calls to different DIRs.
+// readdir itself is buffered by libc (glibc fills a multi-KB buffer per getdents64), so the
+// per-entry cost here is the P/Invoke transition; d_type is returned so callers only need
+// to stat entries whose type is unknown.
 int32_t SystemNative_ReadDir(DIR* dir, DirectoryEntry* outputEntry)
 {
     assert(dir != NULL);
@@ -1844,6 +1847,9 @@ int32_t SystemNative_ReadProcessStatusInfo(pid_t pid, ProcessStatus* processStat
 #endif // __sun
 }
 
+// The positional read/write entrypoints below are synchronous: async file I/O on Unix is
+// implemented by calling them from thread pool threads. There is no kernel completion
+// based backend here, so each outstanding operation occupies a thread.
 int32_t SystemNative_PRead(intptr_t fd, void* buffer, int32_t bufferSize, int64_t fileOffset)
 {
     assert(buffer != NULL);
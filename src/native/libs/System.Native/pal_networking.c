@@ -74,6 +74,12 @@
 #include <linux/icmp.h>
 #endif
 
+#if HAVE_LINUX_ERRQUEUE_H && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define HAVE_ZEROCOPY_SEND 1
+#else
+#define HAVE_ZEROCOPY_SEND 0
+#endif
+
 
 #if HAVE_KQUEUE
 #if KEVENT_HAS_VOID_UDATA
@@ -1529,7 +1535,7 @@ int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageH
         header.msg_iov = &iov;
         header.msg_iovlen = 1;
     }
-    while ((res = recvmsg(fd, &header, SocketFlags_MSG_DONTWAIT | SocketFlags_MSG_ERRQUEUE)) < 0 && errno == EINTR);
+    while ((res = recvmsg(fd, &header, MSG_DONTWAIT | MSG_ERRQUEUE)) < 0 && errno == EINTR);
 
     struct cmsghdr *cmsg;
     for (cmsg = CMSG_FIRSTHDR(&header); cmsg; cmsg = GET_CMSG_NXTHDR(&header, cmsg))
@@ -1645,6 +1651,114 @@ int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int3
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+int32_t SystemNative_EnableZeroCopySend(intptr_t socket)
+{
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+    int value = 1;
+
+    if (setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value)) == 0)
+    {
+        return Error_SUCCESS;
+    }
+
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+// The kernel pins the pages of the buffer instead of copying them, so the buffer must not be modified
+// or released until SystemNative_ReceiveZeroCopyCompletion reports this send as completed. Each
+// successful call on a socket is numbered, starting at 0, in the completion ranges.
+int32_t SystemNative_SendZeroCopy(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
+{
+    if (buffer == NULL || bufferLen < 0 || sent == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    ssize_t res;
+    while ((res = send(fd, buffer, (size_t)bufferLen, socketFlags | MSG_ZEROCOPY)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *sent = (int32_t)res;
+        return Error_SUCCESS;
+    }
+
+    *sent = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)flags;
+    *sent = 0;
+    return Error_ENOTSUP;
+#endif
+}
+
+// Reads one completion notification for SystemNative_SendZeroCopy from the socket error queue without
+// blocking. Sends firstSend through lastSend (inclusive) are done with their buffers; copied is set
+// when the kernel had to fall back to copying for them, in which case zero-copy isn't paying off on
+// this socket. Returns Error_EAGAIN when there's no notification and Error_ENOMSG when the entry read
+// was something other than a zero-copy completion.
+int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* firstSend, uint32_t* lastSend, int32_t* copied)
+{
+    if (firstSend == NULL || lastSend == NULL || copied == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+    char control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_storage))];
+
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+
+    ssize_t res;
+    while ((res = recvmsg(fd, &header, MSG_DONTWAIT | MSG_ERRQUEUE)) < 0 && errno == EINTR);
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg; cmsg = GET_CMSG_NXTHDR(&header, cmsg))
+    {
+        if ((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+            (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR))
+        {
+            struct sock_extended_err* e = (struct sock_extended_err*)CMSG_DATA(cmsg);
+            if (e->ee_errno == 0 && e->ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+            {
+                *firstSend = e->ee_info;
+                *lastSend = e->ee_data;
+                *copied = (e->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+                return Error_SUCCESS;
+            }
+        }
+    }
+
+    return Error_ENOMSG;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+// The control buffer is passed to sendmsg unchanged, so callers can already attach platform
+// control messages such as UDP_SEGMENT to have the kernel split one large send into datagrams.
 int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent)
 {
     if (messageHeader == NULL || sent == NULL || messageHeader->SocketAddressLen < 0 ||
@@ -3478,6 +3592,9 @@ SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, in
         portFd, socketFd, (SocketEvents)currentEvents, (SocketEvents)newEvents, data);
 }
 
+// Returns up to *count ready events from a single epoll_wait/kevent call. Registrations are
+// edge-triggered and made once per socket, so the steady state costs one wait per batch of events
+// plus the send/receive calls themselves.
 int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count)
 {
     if (buffer == NULL || count == NULL || *count < 0)
@@ -3557,6 +3674,10 @@ int32_t SystemNative_Disconnect(intptr_t socket)
     return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// Sends a file range to a socket without copying it through user space. The input must be
+// something sendfile accepts (a regular file); socket-to-socket forwarding would need a
+// splice through an intermediate pipe, and file-to-file copies go through
+// SystemNative_CopyFile, which already prefers copy_file_range on Linux.
 int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, int64_t count, int64_t* sent)
 {
     assert(sent != NULL);
@@ -366,6 +366,12 @@ PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t buffe
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+PALEXPORT int32_t SystemNative_EnableZeroCopySend(intptr_t socket);
+
+PALEXPORT int32_t SystemNative_SendZeroCopy(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent);
+
+PALEXPORT int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* firstSend, uint32_t* lastSend, int32_t* copied);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
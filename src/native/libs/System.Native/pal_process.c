@@ -319,7 +319,10 @@ int32_t SystemNative_ForkAndExecProcess(const char* filename,
     // semantics. For a one gigabyte process, the expected performance gain of using shared memory
     // vfork() rather than fork() is 99.5% merely due to avoiding page faults as the kernel does not
     // need to set all writable pages in the parent process to copy-on-write because the child process
-    // is allowed to write to the parent process memory pages.
+    // is allowed to write to the parent process memory pages. It also skips copying the page
+    // tables, so spawn latency does not grow with the parent's RSS. glibc's posix_spawn is itself
+    // built on clone(CLONE_VM|CLONE_VFORK), so switching to it would not be faster, and it cannot
+    // express the credential and terminal handling done in the child below.
 
     // The thing to remember about shared memory vfork() is the documentation is way out of date.
     // It does the following things:
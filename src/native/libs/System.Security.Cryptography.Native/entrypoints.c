@@ -141,6 +141,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
     DllImportEntry(CryptoNative_EvpDigestFinalXOF)
     DllImportEntry(CryptoNative_EvpDigestOneShot)
+    DllImportEntry(CryptoNative_EvpDigestOneShotBatch)
     DllImportEntry(CryptoNative_EvpDigestReset)
     DllImportEntry(CryptoNative_EvpDigestSqueeze)
     DllImportEntry(CryptoNative_EvpDigestUpdate)
@@ -351,6 +352,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslCtxAddExtraChainCert)
     DllImportEntry(CryptoNative_SslCtxSetCaching)
     DllImportEntry(CryptoNative_SslCtxRemoveSession)
+    DllImportEntry(CryptoNative_SslCtxGetSessionCacheStats)
     DllImportEntry(CryptoNative_SslCtxSetCiphers)
     DllImportEntry(CryptoNative_SslCtxSetDefaultOcspCallback)
     DllImportEntry(CryptoNative_SslCtxSetEncryptionPolicy)
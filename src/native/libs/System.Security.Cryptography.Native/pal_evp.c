@@ -232,6 +232,54 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
     return ret;
 }
 
+int32_t CryptoNative_EvpDigestOneShotBatch(
+    const EVP_MD* type, const void* const* sources, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdStride)
+{
+    ERR_clear_error();
+
+    if (type == NULL || sources == NULL || sourceSizes == NULL || count < 0 || md == NULL)
+    {
+        return 0;
+    }
+
+    int32_t mdSize = CryptoNative_EvpMdSize(type);
+
+    if (mdSize <= 0 || mdStride < mdSize)
+    {
+        return 0;
+    }
+
+    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = SUCCESS;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (sourceSizes[i] < 0 || (i > 0 && EVP_DigestInit_ex(ctx, type, NULL) != SUCCESS))
+        {
+            ret = 0;
+            break;
+        }
+
+        unsigned int size;
+
+        if (EVP_DigestUpdate(ctx, sources[i], (size_t)sourceSizes[i]) != SUCCESS ||
+            EVP_DigestFinal_ex(ctx, md + (size_t)i * (size_t)mdStride, &size) != SUCCESS)
+        {
+            ret = 0;
+            break;
+        }
+    }
+
+    CryptoNative_EvpMdCtxDestroy(ctx);
+    return ret;
+}
+
 int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t len)
 {
     ERR_clear_error();
@@ -81,6 +81,18 @@ Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a sin
 */
 PALEXPORT int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize);
 
+/*
+Function:
+EvpDigestOneShotBatch
+
+Computes the digest of each of count independent buffers, reusing a single EVP_MD_CTX. The
+digest of sources[i] is written to md + i * mdStride; mdStride must be at least the digest size.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestOneShotBatch(
+    const EVP_MD* type, const void* const* sources, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdStride);
+
 /*
 Function:
 EvpDigestXOFOneShot
@@ -711,6 +711,18 @@ int CryptoNative_SslCtxRemoveSession(SSL_CTX* ctx, SSL_SESSION* session)
     return SSL_CTX_remove_session(ctx, session);
 }
 
+void CryptoNative_SslCtxGetSessionCacheStats(SSL_CTX* ctx, int64_t* hits, int64_t* misses, int64_t* cached)
+{
+    assert(hits != NULL);
+    assert(misses != NULL);
+    assert(cached != NULL);
+
+    // void shim functions don't lead to exceptions, so skip the unconditional error clearing.
+    *hits = SSL_CTX_ctrl(ctx, SSL_CTRL_SESS_HIT, 0, NULL);
+    *misses = SSL_CTX_ctrl(ctx, SSL_CTRL_SESS_MISSES, 0, NULL);
+    *cached = SSL_CTX_ctrl(ctx, SSL_CTRL_SESS_NUMBER, 0, NULL);
+}
+
 const char* CryptoNative_SslGetServerName(SSL* ssl)
 {
     return SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
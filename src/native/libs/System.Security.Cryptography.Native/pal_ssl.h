@@ -176,6 +176,13 @@ Removes a session from internal cache.
 */
 PALEXPORT int CryptoNative_SslCtxRemoveSession(SSL_CTX* ctx, SSL_SESSION* session);
 
+/*
+Gets the session cache statistics of the context: the number of handshakes that resumed
+a session, the number of server-side lookups that found no session, and the number of
+sessions currently in the internal cache.
+*/
+PALEXPORT void CryptoNative_SslCtxGetSessionCacheStats(SSL_CTX* ctx, int64_t* hits, int64_t* misses, int64_t* cached);
+
 /*
 Sets callback to log TLS session keys
 */
@@ -266,7 +273,8 @@ Returns the protocol version string for the SSL instance.
 PALEXPORT const char* CryptoNative_SslGetVersion(SSL* ssl);
 
 /*
-Shims the SSL_write method.
+Shims the SSL_write method. Input larger than the maximum fragment length is split
+into multiple TLS records by a single call, all of which go to the write BIO.
 
 Returns the positive number of bytes written when successful, 0 or a negative number
 when an error is encountered.
@@ -307,6 +315,10 @@ PALEXPORT int32_t CryptoNative_SslShutdown(SSL* ssl);
 
 /*
 Shims the SSL_set_bio method.
+
+The managed callers pass memory BIOs and move ciphertext to the socket themselves, so
+kernel TLS offload (SSL_OP_ENABLE_KTLS) never engages: OpenSSL only enables it on
+socket BIOs.
 */
 PALEXPORT void CryptoNative_SslSetBio(SSL* ssl, BIO* rbio, BIO* wbio);
 
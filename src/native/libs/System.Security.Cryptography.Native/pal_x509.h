@@ -249,6 +249,9 @@ PALEXPORT int32_t CryptoNative_X509StoreCtxInit(X509_STORE_CTX* ctx,
 
 /*
 Shims the X509_verify_cert method.
+
+Reused X509 objects keep OpenSSL's per-certificate extension cache, but signatures along
+the chain are checked again on every call; caching of chain results is left to the caller.
 */
 PALEXPORT int32_t CryptoNative_X509VerifyCert(X509_STORE_CTX* ctx);
 
@@ -16,6 +16,9 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#if HAVE_GETRANDOM
+#include <sys/random.h>
+#endif
 #endif
 #if defined(__APPLE__) && __APPLE__
 #include <CommonCrypto/CommonRandom.h>
@@ -100,6 +103,47 @@ int32_t minipal_get_cryptographically_secure_random_bytes(uint8_t* buffer, int32
     return BCRYPT_SUCCESS(status) ? 0 : -1;
 #else
 
+#if HAVE_GETRANDOM
+    // Prefer getrandom: it needs no file descriptor, and newer glibc versions serve it from
+    // the vDSO without entering the kernel. GRND_NONBLOCK keeps the /dev/urandom semantics
+    // of never blocking; if the pool isn't initialized yet, we fall back to /dev/urandom.
+    static bool sMissingGetRandom;
+
+    if (!sMissingGetRandom)
+    {
+        int32_t offset = 0;
+        while (offset != bufferLength)
+        {
+            ssize_t n = getrandom(buffer + offset, (size_t)(bufferLength - offset), GRND_NONBLOCK);
+            if (n == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                if (errno == ENOSYS || errno == EPERM)
+                {
+                    // Not supported by the kernel or blocked by a seccomp filter
+                    sMissingGetRandom = true;
+                }
+                else if (errno != EAGAIN)
+                {
+                    return -1;
+                }
+                break;
+            }
+
+            offset += n;
+        }
+
+        if (offset == bufferLength)
+        {
+            return 0;
+        }
+    }
+#endif
+
     static volatile int rand_des = -1;
     static bool sMissingDevURandom;
 
@@ -9,6 +9,18 @@
 #include <assert.h>
 #include "minipalconfig.h"
 
+// SSE2 and AdvSIMD are part of the baseline ISA on the targets below, so the ASCII block
+// loops use them unconditionally and need no runtime dispatch.
+#if !BIGENDIAN
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTF8_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define UTF8_NEON
+#endif
+#endif
+
 #define HIGH_SURROGATE_START 0xd800
 #define HIGH_SURROGATE_END 0xdbff
 #define LOW_SURROGATE_START 0xdc00
@@ -1078,6 +1090,29 @@ static size_t GetChars(UTF8Encoding* self, unsigned char* bytes, size_t byteCoun
                 }
             }
 
+#if defined(UTF8_SSE2) || defined(UTF8_NEON)
+            // Widen 16 ASCII bytes at a time; fall through to the scalar loop at the first non-ASCII block.
+            while (pStop - pTarget >= 16 && pAllocatedBufferEnd - pTarget >= 16 && pEnd - pSrc >= 16)
+            {
+#if defined(UTF8_SSE2)
+                __m128i block = _mm_loadu_si128((const __m128i*)pSrc);
+                if (_mm_movemask_epi8(block) != 0) break;
+
+                __m128i zero = _mm_setzero_si128();
+                _mm_storeu_si128((__m128i*)pTarget, _mm_unpacklo_epi8(block, zero));
+                _mm_storeu_si128((__m128i*)(pTarget + 8), _mm_unpackhi_epi8(block, zero));
+#else
+                uint8x16_t block = vld1q_u8(pSrc);
+                if (vmaxvq_u8(block) > 0x7F) break;
+
+                vst1q_u16((uint16_t*)pTarget, vmovl_u8(vget_low_u8(block)));
+                vst1q_u16((uint16_t*)(pTarget + 8), vmovl_u8(vget_high_u8(block)));
+#endif
+                pSrc += 16;
+                pTarget += 16;
+            }
+#endif
+
             // Run 8 characters at a time!
             while (pTarget < pStop)
             {
@@ -1583,6 +1618,29 @@ static size_t GetBytes(UTF8Encoding* self, CHAR16_T* chars, size_t charCount, un
                 ENSURE_BUFFER_INC
             }
 
+#if defined(UTF8_SSE2) || defined(UTF8_NEON)
+            // Narrow 16 ASCII chars at a time; fall through to the scalar loop at the first non-ASCII block.
+            while (pStop - pSrc >= 16 && pEnd - pSrc >= 16 && pAllocatedBufferEnd - pTarget >= 16)
+            {
+#if defined(UTF8_SSE2)
+                __m128i lower = _mm_loadu_si128((const __m128i*)pSrc);
+                __m128i upper = _mm_loadu_si128((const __m128i*)(pSrc + 8));
+                __m128i nonAscii = _mm_and_si128(_mm_or_si128(lower, upper), _mm_set1_epi16((short)0xFF80));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xFFFF) break;
+
+                _mm_storeu_si128((__m128i*)pTarget, _mm_packus_epi16(lower, upper));
+#else
+                uint16x8_t lower = vld1q_u16((const uint16_t*)pSrc);
+                uint16x8_t upper = vld1q_u16((const uint16_t*)(pSrc + 8));
+                if (vmaxvq_u16(vorrq_u16(lower, upper)) > 0x7F) break;
+
+                vst1q_u8(pTarget, vcombine_u8(vmovn_u16(lower), vmovn_u16(upper)));
+#endif
+                pSrc += 16;
+                pTarget += 16;
+            }
+#endif
+
             // Run 4 characters at a time!
             while (pSrc < pStop)
             {
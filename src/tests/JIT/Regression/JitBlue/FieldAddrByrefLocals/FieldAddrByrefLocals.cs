@@ -0,0 +1,107 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Stores through "ref T x = ref obj.Field" locals are modeled as stores to the
+// field itself; loads of that field in the loop must observe them, while
+// unrelated loads may be hoisted.
+public class FieldAddrByrefLocals
+{
+    private class Holder
+    {
+        public int A;
+        public int B;
+        public int[] Array;
+    }
+
+    private static int s_static;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int StoreAndReloadSameField(Holder h, int n)
+    {
+        ref int a = ref h.A;
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            a++;
+            sum += h.A + h.B + h.Array.Length;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int StoreThroughAliasedInstance(Holder h1, Holder h2, int n)
+    {
+        ref int a = ref h1.A;
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            a += 2;
+            sum += h2.A;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int StoreToStatic(int n)
+    {
+        ref int s = ref s_static;
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            s = i;
+            sum += s_static;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int ReplaceArray(Holder h, int n)
+    {
+        ref int[] arr = ref h.Array;
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            arr = new int[i + 1];
+            sum += h.Array.Length;
+        }
+        return sum;
+    }
+
+    [Fact]
+    public static void SameField()
+    {
+        Holder h = new Holder { A = 0, B = 10, Array = new int[5] };
+        // sum of (i + 1) + 10 + 5 for i in [0, 4)
+        Assert.Equal(10 + 4 * 15, StoreAndReloadSameField(h, 4));
+        Assert.Equal(4, h.A);
+    }
+
+    [Fact]
+    public static void AliasedInstance()
+    {
+        Holder h = new Holder();
+        Assert.Equal(2 + 4 + 6, StoreThroughAliasedInstance(h, h, 3));
+
+        Holder other = new Holder { A = 1 };
+        Assert.Equal(3, StoreThroughAliasedInstance(new Holder(), other, 3));
+    }
+
+    [Fact]
+    public static void StaticField()
+    {
+        Assert.Equal(0 + 1 + 2 + 3, StoreToStatic(4));
+        Assert.Equal(3, s_static);
+    }
+
+    [Fact]
+    public static void ArrayField()
+    {
+        Holder h = new Holder { Array = new int[100] };
+        Assert.Equal(1 + 2 + 3, ReplaceArray(h, 3));
+        Assert.Equal(3, h.Array.Length);
+    }
+}
@@ -0,0 +1,123 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Range check uses scalar evolution to bound indices in counted loops; the
+// bounds checks below must only be removed when the recurrence provably
+// stays within the array.
+public class ScevRangeCheck
+{
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumWrapping(int[] a, ref int iterations)
+    {
+        int sum = 0;
+        for (int i = 0, j = 0; i < 3; i++, j += int.MaxValue)
+        {
+            sum += a[j];
+            iterations++;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumDown(int[] a, int start)
+    {
+        int sum = 0;
+        for (int i = start; i >= 0; i--)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumOverflowing(int[] a, int start, ref int iterations)
+    {
+        int sum = 0;
+        for (int i = 0, j = start; i < 4; i++, j += 2)
+        {
+            sum += a[j];
+            iterations++;
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumShifted(int[] a, int offset)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i++)
+        {
+            sum += a[i + offset];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int SumTail(int[] a, int count)
+    {
+        int sum = 0;
+        for (int i = 0; i < count; i++)
+        {
+            sum += a[a.Length - 2 + i];
+        }
+        return sum;
+    }
+
+    private static int[] CreateArray(int length)
+    {
+        int[] a = new int[length];
+        for (int i = 0; i < a.Length; i++)
+        {
+            a[i] = i + 1;
+        }
+        return a;
+    }
+
+    [Fact]
+    public static void WrappingIndexThrows()
+    {
+        int[] a = CreateArray(8);
+        int iterations = 0;
+        Assert.Throws<IndexOutOfRangeException>(() => SumWrapping(a, ref iterations));
+        Assert.Equal(1, iterations);
+    }
+
+    [Fact]
+    public static void NegativeStride()
+    {
+        int[] a = CreateArray(8);
+        Assert.Equal(36, SumDown(a, a.Length - 1));
+        Assert.Equal(0, SumDown(a, -1));
+        Assert.Throws<IndexOutOfRangeException>(() => SumDown(a, a.Length));
+    }
+
+    [Fact]
+    public static void OverflowingIndexThrows()
+    {
+        int[] a = CreateArray(8);
+        int iterations = 0;
+        Assert.Equal(1 + 3 + 5 + 7, SumOverflowing(a, 0, ref iterations));
+
+        // The last value of j overflows to a negative index, so the range of
+        // the recurrence can't be derived from its start and end values.
+        iterations = 0;
+        Assert.Throws<IndexOutOfRangeException>(() => SumOverflowing(a, int.MaxValue - 2, ref iterations));
+        Assert.Equal(0, iterations);
+    }
+
+    [Fact]
+    public static void OffByOneThrows()
+    {
+        int[] a = CreateArray(8);
+        Assert.Equal(36, SumShifted(a, 0));
+        Assert.Throws<IndexOutOfRangeException>(() => SumShifted(a, 1));
+        Assert.Throws<IndexOutOfRangeException>(() => SumShifted(a, -1));
+
+        Assert.Equal(15, SumTail(a, 2));
+        Assert.Throws<IndexOutOfRangeException>(() => SumTail(a, 3));
+    }
+}
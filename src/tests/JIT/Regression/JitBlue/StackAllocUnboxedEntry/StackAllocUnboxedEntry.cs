@@ -0,0 +1,102 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// A box whose payload is only passed as 'this' to a value class's unboxed
+// entry may be allocated on the stack; it must still behave like a heap box
+// and must not be referenced after a tail call pops its frame.
+public class StackAllocUnboxedEntry
+{
+    private interface IValue
+    {
+        int Get();
+        int Add(int x);
+        void Increment();
+    }
+
+    private struct Value : IValue
+    {
+        public int X;
+        public long Y;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        public int Get() => X + (int)Y;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        public int Add(int x)
+        {
+            GC.Collect();
+            return X + x;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        public void Increment() => X++;
+    }
+
+    private struct Wrapper<T> : IEquatable<Wrapper<T>>
+    {
+        public T Item;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        public bool Equals(Wrapper<T> other) => Equals(Item, other.Item);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int CallThroughBox(Value v)
+    {
+        IValue boxed = v;
+        return boxed.Get() + boxed.Add(3);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int TailCallThroughBox(Value v, int x)
+    {
+        IValue boxed = v;
+        return boxed.Add(x);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int MutateBox(Value v)
+    {
+        IValue boxed = v;
+        boxed.Increment();
+        boxed.Increment();
+        return boxed.Get();
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static bool AreEqual<T>(T a, T b) where T : IEquatable<T>
+    {
+        object boxed = a;
+        return ((IEquatable<T>)boxed).Equals(b);
+    }
+
+    [Fact]
+    public static void Calls()
+    {
+        Value v = new Value { X = 5, Y = 7 };
+        Assert.Equal(12 + 8, CallThroughBox(v));
+        Assert.Equal(5 + 100, TailCallThroughBox(v, 100));
+    }
+
+    [Fact]
+    public static void Mutation()
+    {
+        Value v = new Value { X = 1, Y = 0 };
+        Assert.Equal(3, MutateBox(v));
+        Assert.Equal(1, v.X);
+    }
+
+    [Fact]
+    public static void SharedGenericEquals()
+    {
+        Wrapper<string> a = new Wrapper<string> { Item = "a" };
+        Wrapper<string> b = new Wrapper<string> { Item = "a" };
+        Wrapper<string> c = new Wrapper<string> { Item = "c" };
+        Assert.True(AreEqual(a, b));
+        Assert.False(AreEqual(a, c));
+    }
+}
@@ -0,0 +1,123 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Switches whose cases only select a constant are lowered to a lookup in a
+// packed immediate; check every case, the default and out of range values.
+public class SwitchValueTable
+{
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Small(int x)
+    {
+        int r;
+        switch (x)
+        {
+            case 0: r = 3; break;
+            case 1: r = 1; break;
+            case 2: r = 4; break;
+            case 3: r = 1; break;
+            case 4: r = 5; break;
+            case 5: r = 9; break;
+            case 6: r = 2; break;
+            default: r = 6; break;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Negative(int x)
+    {
+        int r;
+        switch (x)
+        {
+            case 0: r = -3; break;
+            case 1: r = 0; break;
+            case 2: r = -1; break;
+            case 3: r = 4; break;
+            case 4: r = -3; break;
+            default: r = 7; break;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Wide(uint x)
+    {
+        int r;
+        switch (x)
+        {
+            case 0: r = 1000; break;
+            case 1: r = 12; break;
+            case 2: r = 60000; break;
+            case 3: r = 777; break;
+            default: r = 0; break;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Offset(int x)
+    {
+        int r;
+        switch (x)
+        {
+            case 10: r = 2; break;
+            case 11: r = 2; break;
+            case 12: r = 2; break;
+            case 13: r = 0; break;
+            case 14: r = 1; break;
+            default: r = 3; break;
+        }
+        return r;
+    }
+
+    private static readonly int[] s_small = { 3, 1, 4, 1, 5, 9, 2 };
+    private static readonly int[] s_negative = { -3, 0, -1, 4, -3 };
+    private static readonly int[] s_wide = { 1000, 12, 60000, 777 };
+    private static readonly int[] s_offset = { 2, 2, 2, 0, 1 };
+
+    private static int Expected(int[] table, long index, int defaultValue) =>
+        ((index >= 0) && (index < table.Length)) ? table[index] : defaultValue;
+
+    private static readonly int[] s_inputs = { int.MinValue, -100, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+                                               13, 14, 15, 16, 31, 32, 63, 64, 100, int.MaxValue };
+
+    [Fact]
+    public static void SmallValues()
+    {
+        foreach (int x in s_inputs)
+        {
+            Assert.Equal(Expected(s_small, x, 6), Small(x));
+        }
+    }
+
+    [Fact]
+    public static void NegativeValues()
+    {
+        foreach (int x in s_inputs)
+        {
+            Assert.Equal(Expected(s_negative, x, 7), Negative(x));
+        }
+    }
+
+    [Fact]
+    public static void WideValues()
+    {
+        foreach (int x in s_inputs)
+        {
+            Assert.Equal(Expected(s_wide, (uint)x, 0), Wide((uint)x));
+        }
+    }
+
+    [Fact]
+    public static void OffsetCases()
+    {
+        foreach (int x in s_inputs)
+        {
+            Assert.Equal(Expected(s_offset, (long)x - 10, 3), Offset(x));
+        }
+    }
+}